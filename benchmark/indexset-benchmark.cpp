@@ -0,0 +1,266 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+//
+// Index sets with many small segments, where the cost of finding and
+// dispatching on each segment is a large part of the loop.
+//
+using IndexSetType = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                         RAJA::ListSegment,
+                                         RAJA::RangeStrideSegment>;
+
+#define SEGMENT_LENGTH 8
+
+static void build_indexset(IndexSetType& iset, int num_seg)
+{
+  for (int s = 0; s < num_seg; ++s) {
+    const RAJA::Index_type begin = s * SEGMENT_LENGTH;
+    if (s % 4 == 3) {
+      iset.push_back(
+          RAJA::RangeStrideSegment(begin, begin + SEGMENT_LENGTH, 1));
+    } else {
+      iset.push_back(RAJA::RangeSegment(begin, begin + SEGMENT_LENGTH));
+    }
+  }
+}
+
+static void benchmark_indexset_build(benchmark::State& state)
+{
+  const int num_seg = static_cast<int>(state.range(0));
+  while (state.KeepRunning()) {
+    IndexSetType iset;
+    build_indexset(iset, num_seg);
+    benchmark::DoNotOptimize(iset.getNumSegments());
+  }
+  state.SetItemsProcessed(state.iterations() * num_seg);
+}
+
+static void benchmark_indexset_forall(benchmark::State& state)
+{
+  const int num_seg = static_cast<int>(state.range(0));
+  IndexSetType iset;
+  build_indexset(iset, num_seg);
+
+  std::vector<double> x_vec(num_seg * SEGMENT_LENGTH, 1.0);
+  double* x = x_vec.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+        iset, [=](RAJA::Index_type i) { x[i] = 0.5 * x[i] + 1.0; });
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(state.iterations() * num_seg);
+}
+
+//
+// Color index sets of a 2d mesh of zones, colored by the nodes they touch.
+//
+static std::vector<RAJA::Index_type> zone_to_node(int n)
+{
+  std::vector<RAJA::Index_type> zoneToNode;
+  zoneToNode.reserve(4 * n * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      const RAJA::Index_type node = j * (n + 1) + i;
+      zoneToNode.push_back(node);
+      zoneToNode.push_back(node + 1);
+      zoneToNode.push_back(node + n + 1);
+      zoneToNode.push_back(node + n + 2);
+    }
+  }
+  return zoneToNode;
+}
+
+static void benchmark_indexset_color_serial(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<RAJA::Index_type> zoneToNode = zone_to_node(n);
+  while (state.KeepRunning()) {
+    IndexSetType iset;
+    RAJA::buildLockFreeColorIndexset(
+        iset, zoneToNode.data(), n * n, 4, (n + 1) * (n + 1));
+    benchmark::DoNotOptimize(iset.getNumSegments());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+static void benchmark_indexset_color_parallel(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<RAJA::Index_type> zoneToNode = zone_to_node(n);
+  while (state.KeepRunning()) {
+    IndexSetType iset;
+    RAJA::buildParallelColorIndexset(
+        iset, zoneToNode.data(), n * n, 4, (n + 1) * (n + 1));
+    benchmark::DoNotOptimize(iset.getNumSegments());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+//
+// Aligned index sets of an indirection array made of long runs of
+// consecutive indices with gaps between them.
+//
+static std::vector<RAJA::Index_type> aligned_indices(int n)
+{
+  std::vector<RAJA::Index_type> indices(n);
+  RAJA::Index_type next = 0;
+  for (int i = 0; i < n; ++i) {
+    next += (i % 1000 == 999) ? 3 : 1;
+    indices[i] = next;
+  }
+  return indices;
+}
+
+static void benchmark_indexset_aligned_serial(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<RAJA::Index_type> indices = aligned_indices(n);
+  while (state.KeepRunning()) {
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+    RAJA::buildTypedIndexSetAligned(iset, indices.data(), n);
+    benchmark::DoNotOptimize(iset.getNumSegments());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void benchmark_indexset_aligned_parallel(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<RAJA::Index_type> indices = aligned_indices(n);
+  while (state.KeepRunning()) {
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+    RAJA::buildTypedIndexSetAlignedParallel(iset, indices.data(), n);
+    benchmark::DoNotOptimize(iset.getNumSegments());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+//
+// Memory-bound loops over a nearly sorted list of active indices, stored
+// in full, as deltas, and as runs.
+//
+static std::vector<RAJA::Index_type> active_indices(int n)
+{
+  std::vector<RAJA::Index_type> indices;
+  RAJA::Index_type next = 0;
+  for (int run = 0; static_cast<int>(indices.size()) < n; ++run) {
+    for (int i = 0; i < 16 + run % 48; ++i) {
+      indices.push_back(next++);
+    }
+    next += run % 5 + 1;
+  }
+  indices.resize(n);
+  return indices;
+}
+
+template <typename Segment>
+static void benchmark_list_forall(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<RAJA::Index_type> indices = active_indices(n);
+  const Segment seg(indices.data(), n);
+
+  std::vector<double> x_vec(indices.back() + 1, 1.0);
+  double* x = x_vec.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::seq_exec>(
+        seg, [=](RAJA::Index_type i) { x[i] = 0.5 * x[i] + 1.0; });
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+//
+// Loops over the active half of a range: a conditional in a range loop, a
+// list of the active indices, and a bitmask of them.
+//
+static bool is_active(RAJA::Index_type i) { return (i * 2654435761u) & 256; }
+
+static void benchmark_active_range(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> x_vec(n, 1.0);
+  double* x = x_vec.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::loop_exec>(RAJA::RangeSegment(0, n),
+                                  [=](RAJA::Index_type i) {
+                                    if (is_active(i)) {
+                                      x[i] = 0.5 * x[i] + 1.0;
+                                    }
+                                  });
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Segment>
+static void benchmark_active_segment(benchmark::State& state,
+                                     Segment const& seg)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> x_vec(n, 1.0);
+  double* x = x_vec.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::loop_exec>(
+        seg, [=](RAJA::Index_type i) { x[i] = 0.5 * x[i] + 1.0; });
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static std::vector<RAJA::Index_type> active_half(int n)
+{
+  std::vector<RAJA::Index_type> indices;
+  for (int i = 0; i < n; ++i) {
+    if (is_active(i)) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+
+static void benchmark_active_list(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<RAJA::Index_type> indices = active_half(n);
+  benchmark_active_segment(state,
+                           RAJA::ListSegment(indices.data(), indices.size()));
+}
+
+static void benchmark_active_bitmask(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<RAJA::Index_type> indices = active_half(n);
+  benchmark_active_segment(
+      state, RAJA::BitmaskSegment(0, n, indices.data(), indices.size()));
+}
+
+BENCHMARK(benchmark_indexset_build)->Arg(1000)->Arg(100000);
+BENCHMARK(benchmark_indexset_forall)->Arg(1000)->Arg(100000);
+BENCHMARK(benchmark_indexset_color_serial)->Arg(256)->Arg(1024);
+BENCHMARK(benchmark_indexset_color_parallel)->Arg(256)->Arg(1024);
+BENCHMARK(benchmark_indexset_aligned_serial)->Arg(1 << 20)->Arg(1 << 24);
+BENCHMARK(benchmark_indexset_aligned_parallel)->Arg(1 << 20)->Arg(1 << 24);
+
+BENCHMARK_TEMPLATE(benchmark_list_forall, RAJA::ListSegment)->Arg(1 << 22);
+BENCHMARK_TEMPLATE(benchmark_list_forall, RAJA::DeltaListSegment)
+    ->Arg(1 << 22);
+BENCHMARK_TEMPLATE(benchmark_list_forall, RAJA::RunListSegment)->Arg(1 << 22);
+BENCHMARK(benchmark_active_range)->Arg(1 << 22);
+BENCHMARK(benchmark_active_list)->Arg(1 << 22);
+BENCHMARK(benchmark_active_bitmask)->Arg(1 << 22);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,338 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+// sizes of the layouts, not known to the compiler
+static RAJA::Index_type sizes[3] = {37, 53, 101};
+
+// linear indices visited in a gather order
+static std::vector<RAJA::Index_type> make_gather_ids(RAJA::Index_type n)
+{
+  std::vector<RAJA::Index_type> ids(n);
+  for (RAJA::Index_type i = 0; i < n; i++) {
+    ids[i] = (i * 7919) % n;
+  }
+  return ids;
+}
+
+// recovers (i,j,k) with hardware divides, as Layout::toIndices does
+static void benchmark_divide_indices(benchmark::State& state)
+{
+  benchmark::DoNotOptimize(sizes);
+  const RAJA::Index_type ni = sizes[0], nj = sizes[1], nk = sizes[2];
+  const std::vector<RAJA::Index_type> ids = make_gather_ids(ni * nj * nk);
+
+  while (state.KeepRunning()) {
+    RAJA::Index_type sum = 0;
+    for (RAJA::Index_type id : ids) {
+      RAJA::Index_type i = (id / (nj * nk)) % ni;
+      RAJA::Index_type j = (id / nk) % nj;
+      RAJA::Index_type k = id % nk;
+      sum += i + j + k;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+static void benchmark_layout_divisors(benchmark::State& state)
+{
+  benchmark::DoNotOptimize(sizes);
+  const RAJA::Layout<3> layout(sizes[0], sizes[1], sizes[2]);
+  const auto div = RAJA::make_layout_divisors(layout);
+  const std::vector<RAJA::Index_type> ids = make_gather_ids(layout.size());
+
+  while (state.KeepRunning()) {
+    RAJA::Index_type sum = 0;
+    for (RAJA::Index_type id : ids) {
+      RAJA::Index_type i, j, k;
+      div.toIndices(id, i, j, k);
+      sum += i + j + k;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+static void benchmark_permuted_layout_divisors(benchmark::State& state)
+{
+  benchmark::DoNotOptimize(sizes);
+  const auto layout = RAJA::make_permuted_layout(
+      {{sizes[0], sizes[1], sizes[2]}}, RAJA::as_array<RAJA::PERM_KJI>::get());
+  const auto div = RAJA::make_layout_divisors(layout);
+  const std::vector<RAJA::Index_type> ids = make_gather_ids(layout.size());
+
+  while (state.KeepRunning()) {
+    RAJA::Index_type sum = 0;
+    for (RAJA::Index_type id : ids) {
+      RAJA::Index_type i, j, k;
+      div.toIndices(id, i, j, k);
+      sum += i + j + k;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+static void benchmark_offset_layout_divisors(benchmark::State& state)
+{
+  benchmark::DoNotOptimize(sizes);
+  const auto layout = RAJA::make_offset_layout<3>(
+      {{-1, -1, -1}}, {{sizes[0] - 2, sizes[1] - 2, sizes[2] - 2}});
+  const auto div = RAJA::make_layout_divisors(layout);
+  const std::vector<RAJA::Index_type> ids =
+      make_gather_ids(sizes[0] * sizes[1] * sizes[2]);
+
+  while (state.KeepRunning()) {
+    RAJA::Index_type sum = 0;
+    for (RAJA::Index_type id : ids) {
+      RAJA::Index_type i, j, k;
+      div.toIndices(id, i, j, k);
+      sum += i + j + k;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+// 7-point stencil on an n^3 grid, n = state.range(1), sweeping with
+// dimension state.range(0) innermost
+template <typename LAYOUT>
+static void benchmark_stencil_sweep(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(1);
+  const LAYOUT layout(n, n, n);
+  std::vector<double> a(layout.size(), 1.0);
+  std::vector<double> b(layout.size(), 0.0);
+  RAJA::View<const double, LAYOUT> A(a.data(), n, n, n);
+  RAJA::View<double, LAYOUT> B(b.data(), n, n, n);
+
+  const int inner = static_cast<int>(state.range(0));
+  const int mid = (inner + 2) % 3;
+  const int outer = (inner + 1) % 3;
+
+  while (state.KeepRunning()) {
+    RAJA::Index_type x[3];
+    for (x[outer] = 1; x[outer] < n - 1; x[outer]++) {
+      for (x[mid] = 1; x[mid] < n - 1; x[mid]++) {
+        for (x[inner] = 1; x[inner] < n - 1; x[inner]++) {
+          const RAJA::Index_type i = x[0], j = x[1], k = x[2];
+          B(i, j, k) = A(i, j, k) + A(i - 1, j, k) + A(i + 1, j, k) +
+                       A(i, j - 1, k) + A(i, j + 1, k) + A(i, j, k - 1) +
+                       A(i, j, k + 1);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(b.data());
+  }
+}
+
+// zone data with 20 fields, of which an update touches 4
+static const int num_fields = 20;
+static const RAJA::Index_type num_zones = 1 << 20;
+
+struct Zone {
+  double field[num_fields];
+};
+
+static void benchmark_zone_update_aos(benchmark::State& state)
+{
+  std::vector<Zone> zones(num_zones, Zone{});
+  Zone* z = zones.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::simd_exec>(
+        RAJA::RangeSegment(0, num_zones), [=](RAJA::Index_type i) {
+          z[i].field[0] += (z[i].field[7] + z[i].field[19]) * z[i].field[13];
+        });
+    benchmark::DoNotOptimize(z);
+  }
+}
+
+static void benchmark_zone_update_soa(benchmark::State& state)
+{
+  std::vector<double> fields(num_fields * num_zones, 0.0);
+  double* e = &fields[0 * num_zones];
+  const double* p = &fields[7 * num_zones];
+  const double* dv = &fields[13 * num_zones];
+  const double* q = &fields[19 * num_zones];
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::simd_exec>(
+        RAJA::RangeSegment(0, num_zones),
+        [=](RAJA::Index_type i) { e[i] += (p[i] + q[i]) * dv[i]; });
+    benchmark::DoNotOptimize(e);
+  }
+}
+
+static void benchmark_zone_update_aosoa(benchmark::State& state)
+{
+  using zones_t = RAJA::AoSoA<8,
+                              double, double, double, double, double,
+                              double, double, double, double, double,
+                              double, double, double, double, double,
+                              double, double, double, double, double>;
+  zones_t zones(num_zones);
+  std::fill_n(zones.block<0>(0), zones_t::bytes(num_zones) / sizeof(double),
+              0.0);
+
+  auto e = zones.field<0>();
+  auto p = zones.field<7>();
+  auto dv = zones.field<13>();
+  auto q = zones.field<19>();
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::loop_exec,
+        RAJA::statement::For<1, RAJA::simd_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(
+        RAJA::make_tuple(RAJA::RangeSegment(0, zones.num_blocks()),
+                         RAJA::RangeSegment(0, zones_t::width)),
+        [=](RAJA::Index_type b, RAJA::Index_type l) {
+          e(b, l) += (p(b, l) + q(b, l)) * dv(b, l);
+        });
+    benchmark::DoNotOptimize(zones.data());
+  }
+}
+
+// ltimes contraction phi(m, g, z) += L(m, d) * psi(d, g, z)
+static const RAJA::Index_type num_m = 25;
+static const RAJA::Index_type num_d = 80;
+static const RAJA::Index_type num_g = 32;
+static const RAJA::Index_type num_z = 512;
+
+using LView = RAJA::View<double, RAJA::Layout<2, RAJA::Index_type, 1>>;
+using PsiView = RAJA::View<double, RAJA::Layout<3, RAJA::Index_type, 2>>;
+using PhiView = RAJA::View<double, RAJA::Layout<3, RAJA::Index_type, 2>>;
+
+using LTimesPol = RAJA::KernelPolicy<
+    RAJA::statement::For<0, RAJA::loop_exec,
+      RAJA::statement::For<1, RAJA::loop_exec,
+        RAJA::statement::For<2, RAJA::loop_exec,
+          RAJA::statement::For<3, RAJA::simd_exec,
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >
+    >
+  >;
+
+static void benchmark_ltimes_raw(benchmark::State& state)
+{
+  std::vector<double> L(num_m * num_d, 1.0);
+  std::vector<double> psi(num_d * num_g * num_z, 1.0);
+  std::vector<double> phi(num_m * num_g * num_z, 0.0);
+  const double* RAJA_RESTRICT L_ptr = L.data();
+  const double* RAJA_RESTRICT psi_ptr = psi.data();
+  double* RAJA_RESTRICT phi_ptr = phi.data();
+
+  while (state.KeepRunning()) {
+    for (RAJA::Index_type m = 0; m < num_m; ++m) {
+      for (RAJA::Index_type d = 0; d < num_d; ++d) {
+        for (RAJA::Index_type g = 0; g < num_g; ++g) {
+          for (RAJA::Index_type z = 0; z < num_z; ++z) {
+            phi_ptr[(m * num_g + g) * num_z + z] +=
+                L_ptr[m * num_d + d] * psi_ptr[(d * num_g + g) * num_z + z];
+          }
+        }
+      }
+    }
+    benchmark::DoNotOptimize(phi_ptr);
+  }
+}
+
+static void benchmark_ltimes_views(benchmark::State& state)
+{
+  std::vector<double> L_data(num_m * num_d, 1.0);
+  std::vector<double> psi_data(num_d * num_g * num_z, 1.0);
+  std::vector<double> phi_data(num_m * num_g * num_z, 0.0);
+  LView L(L_data.data(), num_m, num_d);
+  PsiView psi(psi_data.data(), num_d, num_g, num_z);
+  PhiView phi(phi_data.data(), num_m, num_g, num_z);
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<LTimesPol>(
+        RAJA::make_tuple(RAJA::RangeSegment(0, num_m),
+                         RAJA::RangeSegment(0, num_d),
+                         RAJA::RangeSegment(0, num_g),
+                         RAJA::RangeSegment(0, num_z)),
+        [=](RAJA::Index_type m,
+            RAJA::Index_type d,
+            RAJA::Index_type g,
+            RAJA::Index_type z) { phi(m, g, z) += L(m, d) * psi(d, g, z); });
+    benchmark::DoNotOptimize(phi_data.data());
+  }
+}
+
+static void benchmark_ltimes_cursors(benchmark::State& state)
+{
+  std::vector<double> L_data(num_m * num_d, 1.0);
+  std::vector<double> psi_data(num_d * num_g * num_z, 1.0);
+  std::vector<double> phi_data(num_m * num_g * num_z, 0.0);
+  LView L(L_data.data(), num_m, num_d);
+  PsiView psi(psi_data.data(), num_d, num_g, num_z);
+  PhiView phi(phi_data.data(), num_m, num_g, num_z);
+
+  using LCursor = RAJA::ViewCursor<LView, 0, 1>;
+  using PsiCursor = RAJA::ViewCursor<PsiView, 1, 2, 3>;
+  using PhiCursor = RAJA::ViewCursor<PhiView, 0, 2, 3>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel_param<LTimesPol>(
+        RAJA::make_tuple(RAJA::RangeSegment(0, num_m),
+                         RAJA::RangeSegment(0, num_d),
+                         RAJA::RangeSegment(0, num_g),
+                         RAJA::RangeSegment(0, num_z)),
+        RAJA::make_tuple(PhiCursor(phi), LCursor(L), PsiCursor(psi)),
+        [=](RAJA::Index_type,
+            RAJA::Index_type,
+            RAJA::Index_type,
+            RAJA::Index_type,
+            PhiCursor& phi_c,
+            LCursor& L_c,
+            PsiCursor& psi_c) { phi_c() += L_c() * psi_c(); });
+    benchmark::DoNotOptimize(phi_data.data());
+  }
+}
+
+BENCHMARK(benchmark_divide_indices);
+BENCHMARK(benchmark_layout_divisors);
+BENCHMARK(benchmark_permuted_layout_divisors);
+BENCHMARK(benchmark_offset_layout_divisors);
+
+BENCHMARK(benchmark_zone_update_aos);
+BENCHMARK(benchmark_zone_update_soa);
+BENCHMARK(benchmark_zone_update_aosoa);
+
+BENCHMARK(benchmark_ltimes_raw);
+BENCHMARK(benchmark_ltimes_views);
+BENCHMARK(benchmark_ltimes_cursors);
+
+// each dimension innermost in turn, on a 256^3 grid
+static void stencil_sweep_args(benchmark::internal::Benchmark* b)
+{
+  for (int inner = 0; inner < 3; ++inner) {
+    b->Args({inner, 256});
+  }
+}
+
+BENCHMARK_TEMPLATE(benchmark_stencil_sweep, RAJA::Layout<3>)
+    ->Apply(stencil_sweep_args);
+BENCHMARK_TEMPLATE(benchmark_stencil_sweep, RAJA::TiledLayout<3, 8, 8, 8>)
+    ->Apply(stencil_sweep_args);
+BENCHMARK_TEMPLATE(benchmark_stencil_sweep, RAJA::TiledLayout<3, 16, 16, 16>)
+    ->Apply(stencil_sweep_args);
+BENCHMARK_TEMPLATE(benchmark_stencil_sweep, RAJA::MortonLayout<3>)
+    ->Apply(stencil_sweep_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <cmath>
+#include <vector>
+
+#include <omp.h>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+//
+// Loops whose per-iteration cost is skewed, like loops over the zones of
+// a material list where a few mixed zones do most of the work. A static
+// schedule leaves most threads idle while the ones holding the expensive
+// iterations finish.
+//
+#define N 20000
+
+// cost grows linearly across the range
+static int linear_work(int i) { return 1 + i / 16; }
+
+// one iteration in 64 is 400 times as expensive as the rest
+static int spiky_work(int i) { return (i % 64 == 0) ? 400 : 1; }
+
+template <int (*WORK)(int)>
+static std::vector<int> make_work()
+{
+  std::vector<int> work(N);
+  for (int i = 0; i < N; i++) {
+    work[i] = WORK(i);
+  }
+  return work;
+}
+
+template <typename EXEC_POLICY, int (*WORK)(int)>
+static void benchmark_schedule(benchmark::State& state)
+{
+  const std::vector<int> work_vec = make_work<WORK>();
+  const int* work = work_vec.data();
+  std::vector<double> out_vec(N);
+  double* out = out_vec.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::RangeSegment(0, N), [=](int i) {
+      double x = static_cast<double>(i);
+      for (int k = 0; k < work[i]; ++k) {
+        x = std::sqrt(x + k);
+      }
+      out[i] = x;
+    });
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+template <int (*WORK)(int)>
+static void benchmark_schedule_runtime(benchmark::State& state)
+{
+  // the chunk size is chosen when the program runs
+  omp_set_schedule(omp_sched_dynamic, static_cast<int>(state.range(0)));
+  benchmark_schedule<RAJA::omp_parallel_for_runtime, WORK>(state);
+}
+
+BENCHMARK_TEMPLATE(benchmark_schedule,
+                   RAJA::omp_parallel_for_exec,
+                   linear_work);
+BENCHMARK_TEMPLATE(benchmark_schedule,
+                   RAJA::omp_parallel_for_static<16>,
+                   linear_work);
+BENCHMARK_TEMPLATE(benchmark_schedule,
+                   RAJA::omp_parallel_for_dynamic<16>,
+                   linear_work);
+BENCHMARK_TEMPLATE(benchmark_schedule,
+                   RAJA::omp_parallel_for_guided<4>,
+                   linear_work);
+BENCHMARK_TEMPLATE(benchmark_schedule_runtime, linear_work)
+    ->Arg(1)
+    ->Arg(64);
+
+BENCHMARK_TEMPLATE(benchmark_schedule,
+                   RAJA::omp_parallel_for_exec,
+                   spiky_work);
+BENCHMARK_TEMPLATE(benchmark_schedule,
+                   RAJA::omp_parallel_for_static<16>,
+                   spiky_work);
+BENCHMARK_TEMPLATE(benchmark_schedule,
+                   RAJA::omp_parallel_for_dynamic<16>,
+                   spiky_work);
+BENCHMARK_TEMPLATE(benchmark_schedule,
+                   RAJA::omp_parallel_for_guided<4>,
+                   spiky_work);
+BENCHMARK_TEMPLATE(benchmark_schedule_runtime, spiky_work)
+    ->Arg(1)
+    ->Arg(64);
+
+BENCHMARK_MAIN();
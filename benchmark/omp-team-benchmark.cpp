@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+//
+// A cycle of many short loops, like the zone and node updates of a physics
+// package. With loops this short the cost of starting and finishing each
+// parallel loop dominates, which the persistent team avoids.
+//
+#define LOOPS_PER_CYCLE 100
+
+static void cycle_loops(double* x, double* y, RAJA::RangeSegment range)
+{
+  for (int l = 0; l < LOOPS_PER_CYCLE; l += 2) {
+    RAJA::forall<RAJA::omp_team_for_nowait_exec>(range, [=](int i) {
+      y[i] = 0.5 * x[i] + 1.0;
+    });
+    RAJA::forall<RAJA::omp_team_for_nowait_exec>(range, [=](int i) {
+      x[i] = 0.5 * y[i] - 1.0;
+    });
+  }
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_parallel_for(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> x_vec(n, 1.0);
+  std::vector<double> y_vec(n, 0.0);
+  double* x = x_vec.data();
+  double* y = y_vec.data();
+
+  while (state.KeepRunning()) {
+    for (int l = 0; l < LOOPS_PER_CYCLE; l += 2) {
+      RAJA::forall<EXEC_POLICY>(RAJA::RangeSegment(0, n), [=](int i) {
+        y[i] = 0.5 * x[i] + 1.0;
+      });
+      RAJA::forall<EXEC_POLICY>(RAJA::RangeSegment(0, n), [=](int i) {
+        x[i] = 0.5 * y[i] - 1.0;
+      });
+    }
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(state.iterations() * LOOPS_PER_CYCLE);
+}
+
+static void benchmark_omp_region_nowait(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> x_vec(n, 1.0);
+  std::vector<double> y_vec(n, 0.0);
+  double* x = x_vec.data();
+  double* y = y_vec.data();
+
+  while (state.KeepRunning()) {
+    RAJA::region<RAJA::omp_parallel_region>([=]() {
+      for (int l = 0; l < LOOPS_PER_CYCLE; l += 2) {
+        RAJA::forall<RAJA::omp_for_nowait_exec>(RAJA::RangeSegment(0, n),
+                                                [=](int i) {
+                                                  y[i] = 0.5 * x[i] + 1.0;
+                                                });
+        RAJA::forall<RAJA::omp_for_nowait_exec>(RAJA::RangeSegment(0, n),
+                                                [=](int i) {
+                                                  x[i] = 0.5 * y[i] - 1.0;
+                                                });
+      }
+    });
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(state.iterations() * LOOPS_PER_CYCLE);
+}
+
+// one team region per cycle
+static void benchmark_team_cycle(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> x_vec(n, 1.0);
+  std::vector<double> y_vec(n, 0.0);
+  double* x = x_vec.data();
+  double* y = y_vec.data();
+
+  while (state.KeepRunning()) {
+    RAJA::region<RAJA::omp_team_region>(
+        [=]() { cycle_loops(x, y, RAJA::RangeSegment(0, n)); });
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(state.iterations() * LOOPS_PER_CYCLE);
+}
+
+// one team region for the whole run, as a driver would use it
+static void benchmark_team_persistent(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> x_vec(n, 1.0);
+  std::vector<double> y_vec(n, 0.0);
+  double* x = x_vec.data();
+  double* y = y_vec.data();
+
+  RAJA::region<RAJA::omp_team_region>([&]() {
+    while (state.KeepRunning()) {
+      cycle_loops(x, y, RAJA::RangeSegment(0, n));
+      RAJA::synchronize<RAJA::omp_team_synchronize>();
+      benchmark::DoNotOptimize(x);
+    }
+  });
+  state.SetItemsProcessed(state.iterations() * LOOPS_PER_CYCLE);
+}
+
+BENCHMARK_TEMPLATE(benchmark_parallel_for, RAJA::omp_parallel_for_exec)
+    ->Arg(1000)
+    ->Arg(10000);
+BENCHMARK(benchmark_omp_region_nowait)->Arg(1000)->Arg(10000);
+BENCHMARK(benchmark_team_cycle)->Arg(1000)->Arg(10000);
+BENCHMARK(benchmark_team_persistent)->Arg(1000)->Arg(10000);
+
+BENCHMARK_MAIN();
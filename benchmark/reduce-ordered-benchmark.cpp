@@ -0,0 +1,77 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <iostream>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+//
+// Short loops with a reset per "timestep" are the case where the per-thread
+// buffer of the ordered reducer used to cost the most (allocation on every
+// reset, false sharing on every combine).
+//
+#define N 10000
+
+template <typename REDUCE_POLICY>
+static void benchmark_reduce_sum(benchmark::State& state)
+{
+  double* a = new double[N];
+
+  for (int i = 0; i < N; i++) {
+    a[i] = 1.0;
+  }
+
+  RAJA::ReduceSum<REDUCE_POLICY, double> sum(0.0);
+
+  while (state.KeepRunning()) {
+    sum.reset(0.0);
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                              [=](int i) { sum += a[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+
+  delete[] a;
+}
+
+template <typename REDUCE_POLICY>
+static void benchmark_reduce_minmaxsum(benchmark::State& state)
+{
+  double* a = new double[N];
+
+  for (int i = 0; i < N; i++) {
+    a[i] = static_cast<double>(i % 17);
+  }
+
+  RAJA::ReduceSum<REDUCE_POLICY, double> sum(0.0);
+  RAJA::ReduceMin<REDUCE_POLICY, double> min(0.0);
+  RAJA::ReduceMax<REDUCE_POLICY, double> max(0.0);
+
+  while (state.KeepRunning()) {
+    sum.reset(0.0);
+    min.reset(0.0);
+    max.reset(0.0);
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                              [=](int i) {
+                                                sum += a[i];
+                                                min.min(a[i]);
+                                                max.max(a[i]);
+                                              });
+    benchmark::DoNotOptimize(sum.get());
+    benchmark::DoNotOptimize(min.get());
+    benchmark::DoNotOptimize(max.get());
+  }
+
+  delete[] a;
+}
+
+BENCHMARK_TEMPLATE(benchmark_reduce_sum, RAJA::omp_reduce);
+BENCHMARK_TEMPLATE(benchmark_reduce_sum, RAJA::omp_reduce_ordered);
+BENCHMARK_TEMPLATE(benchmark_reduce_minmaxsum, RAJA::omp_reduce);
+BENCHMARK_TEMPLATE(benchmark_reduce_minmaxsum, RAJA::omp_reduce_ordered);
+
+BENCHMARK_MAIN();
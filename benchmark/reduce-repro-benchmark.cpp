@@ -0,0 +1,49 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <cmath>
+#include <iostream>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N 10000000
+
+template <template <typename, typename> class REDUCER,
+          typename EXEC_POLICY,
+          typename REDUCE_POLICY>
+static void benchmark_sum(benchmark::State& state)
+{
+  double* a = new double[N];
+
+  for (int i = 0; i < N; i++) {
+    a[i] = std::sin(static_cast<double>(i));
+  }
+
+  while (state.KeepRunning()) {
+    REDUCER<REDUCE_POLICY, double> sum(0.0);
+    RAJA::forall<EXEC_POLICY>(RAJA::RangeSegment(0, N),
+                              [=](int i) { sum += a[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+
+  delete[] a;
+}
+
+BENCHMARK_TEMPLATE(benchmark_sum, RAJA::ReduceSum,
+                   RAJA::loop_exec, RAJA::seq_reduce);
+BENCHMARK_TEMPLATE(benchmark_sum, RAJA::ReduceReproSum,
+                   RAJA::loop_exec, RAJA::seq_reduce);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_sum, RAJA::ReduceSum,
+                   RAJA::omp_parallel_for_exec, RAJA::omp_reduce);
+BENCHMARK_TEMPLATE(benchmark_sum, RAJA::ReduceReproSum,
+                   RAJA::omp_parallel_for_exec, RAJA::omp_reduce);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N 10000000
+
+// sorts with this comparator cannot use the radix path
+struct abs_less {
+  bool operator()(double a, double b) const
+  {
+    return std::abs(a) < std::abs(b);
+  }
+};
+
+static std::vector<double> make_keys()
+{
+  std::vector<double> keys(N);
+  for (int i = 0; i < N; i++) {
+    keys[i] = std::sin(static_cast<double>(i)) * 1.0e6;
+  }
+  return keys;
+}
+
+template <typename COMP>
+static void benchmark_std_sort(benchmark::State& state)
+{
+  const std::vector<double> orig = make_keys();
+  std::vector<double> keys(N);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = orig;
+    state.ResumeTiming();
+    std::sort(keys.begin(), keys.end(), COMP{});
+    benchmark::DoNotOptimize(keys.data());
+  }
+}
+
+template <typename EXEC_POLICY, typename COMP>
+static void benchmark_raja_sort(benchmark::State& state)
+{
+  const std::vector<double> orig = make_keys();
+  std::vector<double> keys(N);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = orig;
+    state.ResumeTiming();
+    RAJA::sort<EXEC_POLICY>(keys, COMP{});
+    benchmark::DoNotOptimize(keys.data());
+  }
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_raja_sort_pairs(benchmark::State& state)
+{
+  const std::vector<double> orig = make_keys();
+  std::vector<double> keys(N);
+  std::vector<int> vals(N);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = orig;
+    for (int i = 0; i < N; i++) {
+      vals[i] = i;
+    }
+    state.ResumeTiming();
+    RAJA::sort_pairs<EXEC_POLICY>(keys, vals);
+    benchmark::DoNotOptimize(vals.data());
+  }
+}
+
+BENCHMARK_TEMPLATE(benchmark_std_sort, std::less<double>);
+BENCHMARK_TEMPLATE(benchmark_std_sort, abs_less);
+
+BENCHMARK_TEMPLATE(benchmark_raja_sort, RAJA::loop_exec, std::less<double>);
+BENCHMARK_TEMPLATE(benchmark_raja_sort, RAJA::loop_exec, abs_less);
+BENCHMARK_TEMPLATE(benchmark_raja_sort_pairs, RAJA::loop_exec);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_raja_sort,
+                   RAJA::omp_parallel_for_exec,
+                   std::less<double>);
+BENCHMARK_TEMPLATE(benchmark_raja_sort, RAJA::omp_parallel_for_exec, abs_less);
+BENCHMARK_TEMPLATE(benchmark_raja_sort_pairs, RAJA::omp_parallel_for_exec);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_raja_sort, RAJA::tbb_for_exec, std::less<double>);
+BENCHMARK_TEMPLATE(benchmark_raja_sort, RAJA::tbb_for_exec, abs_less);
+BENCHMARK_TEMPLATE(benchmark_raja_sort_pairs, RAJA::tbb_for_exec);
+#endif
+
+BENCHMARK_MAIN();
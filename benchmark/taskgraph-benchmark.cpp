@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+using LockFreeIndexSet = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                             RAJA::ListSegment,
+                                             RAJA::RangeStrideSegment>;
+
+using TaskGraphPolicy =
+    RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::loop_exec>;
+using TaskGraphIntervalPolicy =
+    RAJA::ExecPolicy<RAJA::omp_taskgraph_interval_segit, RAJA::loop_exec>;
+
+//
+// Scatter a 3-point stencil along the slowest dimension of a lock-free
+// block index set without atomics, as a node-centered update from zones
+// would. The dependency graph keeps neighboring blocks apart.
+//
+template <typename EXEC_POLICY>
+static void benchmark_lockfree_block(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const int dims = static_cast<int>(state.range(1));
+  const RAJA::Index_type fast = (dims == 1) ? n * n * n : n;
+  const RAJA::Index_type mid = (dims == 1) ? 0 : (dims == 2) ? n * n : n;
+  const RAJA::Index_type slow = (dims == 3) ? n : 0;
+  const RAJA::Index_type stride = (dims == 1) ? 1 : (dims == 2) ? n : n * n;
+
+  LockFreeIndexSet iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fast, mid, slow);
+
+  const RAJA::Index_type len = iset.getLength();
+  std::vector<double> x_vec(len, 1.0);
+  double* x = x_vec.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(iset, [=](RAJA::Index_type i) {
+      if (i >= stride) {
+        x[i - stride] += 0.25;
+      }
+      x[i] += 0.5;
+      if (i + stride < len) {
+        x[i + stride] += 0.25;
+      }
+    });
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+//
+// Many small segments, each waiting on the two before it, plus one segment
+// that every other segment waits on. This measures the cost of replaying
+// the graph itself and exercises a node with a very large fan-out.
+//
+template <typename EXEC_POLICY>
+static void benchmark_fine_graph(benchmark::State& state)
+{
+  const int num_seg = static_cast<int>(state.range(0));
+  const int seg_len = 16;
+
+  LockFreeIndexSet iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * seg_len, (s + 1) * seg_len));
+  }
+  iset.initDependencyGraph();
+  RAJA::DepGraph* graph = iset.getDependencyGraph();
+  for (int s = 0; s < num_seg; ++s) {
+    if (s > 0) {
+      graph->addDependentTask(0, s);
+    }
+    for (int d = s + 2; d <= s + 3 && d < num_seg; ++d) {
+      graph->addDependentTask(s, d);
+    }
+  }
+  iset.finalizeDependencyGraph();
+
+  std::vector<double> x_vec(num_seg * seg_len, 1.0);
+  double* x = x_vec.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(iset, [=](RAJA::Index_type i) {
+      x[i] = 0.5 * x[i] + 1.0;
+    });
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(state.iterations() * num_seg);
+}
+
+BENCHMARK_TEMPLATE(benchmark_lockfree_block, TaskGraphPolicy)
+    ->ArgPair(64, 1)
+    ->ArgPair(64, 2)
+    ->ArgPair(64, 3)
+    ->ArgPair(128, 3);
+BENCHMARK_TEMPLATE(benchmark_lockfree_block, TaskGraphIntervalPolicy)
+    ->ArgPair(64, 1)
+    ->ArgPair(64, 2)
+    ->ArgPair(64, 3)
+    ->ArgPair(128, 3);
+BENCHMARK_TEMPLATE(benchmark_fine_graph, TaskGraphPolicy)
+    ->Arg(1000)
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(benchmark_fine_graph, TaskGraphIntervalPolicy)
+    ->Arg(1000)
+    ->Arg(100000);
+
+BENCHMARK_MAIN();
@@ -27,4 +27,17 @@ if (ENABLE_TBB)
     message(WARNING "TBB NOT FOUND")
     set(ENABLE_TBB Off)
   endif()
+endif ()
+
+if (ENABLE_THREADS)
+  find_package(Threads)
+  if(Threads_FOUND)
+    blt_register_library(
+      NAME threads
+      LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+    message(STATUS "Threads Enabled")
+  else()
+    message(WARNING "Threads NOT FOUND")
+    set(ENABLE_THREADS Off)
+  endif()
 endif ()
\ No newline at end of file
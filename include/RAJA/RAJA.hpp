@@ -64,6 +64,10 @@
 #include "RAJA/policy/tbb.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+#include "RAJA/policy/threads.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 #include "RAJA/policy/cuda.hpp"
 #endif
@@ -106,11 +110,19 @@
 // Multidimensional layouts and views
 //
 #include "RAJA/util/Layout.hpp"
+#include "RAJA/util/LayoutDivisors.hpp"
+#include "RAJA/util/MortonLayout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
 #include "RAJA/util/PermutedLayout.hpp"
 #include "RAJA/util/StaticLayout.hpp"
+#include "RAJA/util/TiledLayout.hpp"
 #include "RAJA/util/View.hpp"
 
+//
+// Array-of-structs-of-arrays storage for multi-field data
+//
+#include "RAJA/util/AoSoA.hpp"
+
 
 //
 // View for sequences of objects
@@ -157,7 +169,12 @@
 //
 
 #include "RAJA/index/IndexSetUtils.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
 
 #include "RAJA/pattern/scan.hpp"
 
+#include "RAJA/pattern/sort.hpp"
+
+#include "RAJA/pattern/compact.hpp"
+
 #endif  // closing endif for header file include guard
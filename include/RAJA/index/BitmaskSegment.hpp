@@ -0,0 +1,387 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining bitmask segment classes.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BitmaskSegment_HPP
+#define RAJA_BitmaskSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#if defined(RAJA_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/CompressedListSegment.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! number of trailing zero bits of a nonzero word
+RAJA_HOST_DEVICE RAJA_INLINE int bitmask_ctz(uint64_t bits)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return __ffsll(static_cast<long long>(bits)) - 1;
+#elif defined(RAJA_COMPILER_MSVC)
+  unsigned long idx;
+  _BitScanForward64(&idx, bits);
+  return static_cast<int>(idx);
+#else
+  return __builtin_ctzll(bits);
+#endif
+}
+
+//! number of set bits of a word
+RAJA_INLINE int bitmask_popcount(uint64_t bits)
+{
+#if defined(RAJA_COMPILER_MSVC)
+  return static_cast<int>(__popcnt64(bits));
+#else
+  return __builtin_popcountll(bits);
+#endif
+}
+
+//! gives the index at a position of a TypedBitmaskSegment
+template <typename T>
+struct BitmaskDecoder {
+  using value_type = T;
+
+  const uint64_t* words = nullptr;
+  const Index_type* rank = nullptr;
+  Index_type num_words = 0;
+  T first = 0;
+
+  RAJA_HOST_DEVICE inline value_type operator()(Index_type pos) const
+  {
+    // last word with at most pos set bits before it
+    Index_type lo = 0;
+    Index_type hi = num_words - 1;
+    while (lo < hi) {
+      const Index_type mid = (lo + hi + 1) / 2;
+      if (rank[mid] <= pos) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
+      }
+    }
+    uint64_t bits = words[lo];
+    for (Index_type k = pos - rank[lo]; k > 0; --k) {
+      bits &= bits - 1;
+    }
+    return static_cast<value_type>(first + lo * 64 + bitmask_ctz(bits));
+  }
+};
+
+//! loop body over the words of a TypedBitmaskSegment
+template <typename T, typename Body>
+struct BitmaskWordBody {
+  const uint64_t* words;
+  T first;
+  Body body;
+
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE void operator()(Index_type w) const
+  {
+    uint64_t bits = words[w];
+    while (bits != 0) {
+      body(static_cast<T>(first + w * 64 + bitmask_ctz(bits)));
+      bits &= bits - 1;
+    }
+  }
+};
+
+//! loop body over the words of a TypedBitmaskSegment with icount
+template <typename T, typename IndexT, typename Body>
+struct BitmaskWordIcountBody {
+  const uint64_t* words;
+  const Index_type* rank;
+  T first;
+  Index_type icount;
+  Body body;
+
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE void operator()(Index_type w) const
+  {
+    uint64_t bits = words[w];
+    Index_type i = icount + rank[w];
+    while (bits != 0) {
+      body(static_cast<IndexT>(i),
+           static_cast<T>(first + w * 64 + bitmask_ctz(bits)));
+      bits &= bits - 1;
+      ++i;
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class representing the indices of a range that are set in a
+ *         packed bit array.
+ *
+ *         Bit b of word w is set when index begin + 64 * w + b is in the
+ *         segment, so a segment that holds a large part of its range takes
+ *         one bit per index of the range. forall runs a loop over the words
+ *         with the given policy and visits the set bits of each word in
+ *         order, skipping zero words without a branch per index.
+ *
+ *         The iterators give random access by searching the bit counts of
+ *         the words, for forall_Icount and other uses of begin().
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class TypedBitmaskSegment
+{
+  static_assert(std::is_integral<T>::value,
+                "TypedBitmaskSegment index type must be integral");
+
+  using Decoder = detail::BitmaskDecoder<T>;
+
+  //! a set of indices as it is stored by the segment
+  struct Mask {
+    std::vector<uint64_t> words;
+    std::vector<Index_type> rank;
+  };
+
+public:
+  //! value type for storage
+  using value_type = T;
+
+  //! iterator type that decodes indices
+  using iterator = detail::CompressedListIterator<Decoder>;
+
+  //! expose underlying index type
+  using IndexType = RAJA::Index_type;
+
+  //! prevent compiler from providing a default constructor
+  TypedBitmaskSegment() = delete;
+
+  ///
+  /// \brief Construct segment holding the given indices of the range
+  ///        [begin, end) and use given camp resource to allocate the bits.
+  ///
+  /// The indices may come in any order. Aborts or throws if an index is
+  /// outside the range.
+  ///
+  TypedBitmaskSegment(value_type begin,
+                      value_type end,
+                      const value_type* values,
+                      Index_type length,
+                      camp::resources::Resource& resource)
+      : TypedBitmaskSegment(begin,
+                            encodeMask(begin, end, values, length),
+                            resource)
+  {
+  }
+
+  ///
+  /// \brief Construct segment holding the given indices of the range
+  ///        [begin, end) in host memory.
+  ///
+  TypedBitmaskSegment(value_type begin,
+                      value_type end,
+                      const value_type* values,
+                      Index_type length)
+      : TypedBitmaskSegment(begin, end, values, length, hostResource())
+  {
+  }
+
+  ///
+  /// Swap function for copy-and-swap idiom.
+  ///
+  void swap(TypedBitmaskSegment& other)
+  {
+    m_words.swap(other.m_words);
+    m_rank.swap(other.m_rank);
+    camp::safe_swap(m_first, other.m_first);
+    camp::safe_swap(m_size, other.m_size);
+  }
+
+  //! accessor to get the begin iterator for a TypedBitmaskSegment
+  RAJA_HOST_DEVICE iterator begin() const { return iterator(decoder(), 0); }
+
+  //! accessor to get the end iterator for a TypedBitmaskSegment
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(decoder(), m_size);
+  }
+
+  //! accessor to retrieve the total number of elements in the segment
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  //! accessor to retrieve the first index of the range
+  RAJA_HOST_DEVICE value_type getFirst() const { return m_first; }
+
+  //! accessor to retrieve the number of 64-bit words
+  RAJA_HOST_DEVICE Index_type getNumWords() const { return m_words.size(); }
+
+  //! accessor to retrieve the words
+  RAJA_HOST_DEVICE const uint64_t* getWords() const { return m_words.data(); }
+
+  //! accessor to retrieve the number of set bits before each word
+  RAJA_HOST_DEVICE const Index_type* getWordRanks() const
+  {
+    return m_rank.data();
+  }
+
+  ///
+  /// Equality operator returns true if segments hold the same indices.
+  ///
+  bool operator==(const TypedBitmaskSegment& other) const
+  {
+    return m_size == other.m_size
+           && std::equal(begin(), end(), other.begin());
+  }
+
+  ///
+  /// Inequality operator returns true if segments are not equal, else false.
+  ///
+  bool operator!=(const TypedBitmaskSegment& other) const
+  {
+    return !(*this == other);
+  }
+
+private:
+  TypedBitmaskSegment(value_type begin,
+                      Mask const& mask,
+                      camp::resources::Resource& resource)
+      : m_words(resource, mask.words.data(), mask.words.size()),
+        m_rank(resource, mask.rank.data(), mask.rank.size()),
+        m_first(begin),
+        m_size(mask.rank.back())
+  {
+  }
+
+  static camp::resources::Resource& hostResource()
+  {
+    static camp::resources::Resource host{camp::resources::Host()};
+    return host;
+  }
+
+  static Mask encodeMask(value_type begin,
+                         value_type end,
+                         const value_type* values,
+                         Index_type length)
+  {
+    Mask mask;
+    const Index_type span = end > begin ? Index_type(end - begin) : 0;
+    mask.words.assign((span + 63) / 64, 0);
+    for (Index_type i = 0; i < length; ++i) {
+      if (values[i] < begin || values[i] >= end) {
+        RAJA_ABORT_OR_THROW("TypedBitmaskSegment: index outside the range");
+      }
+      const Index_type bit = values[i] - begin;
+      mask.words[bit / 64] |= uint64_t(1) << (bit % 64);
+    }
+    mask.rank.assign(mask.words.size() + 1, 0);
+    for (size_t w = 0; w < mask.words.size(); ++w) {
+      mask.rank[w + 1] =
+          mask.rank[w] + detail::bitmask_popcount(mask.words[w]);
+    }
+    return mask;
+  }
+
+  RAJA_HOST_DEVICE Decoder decoder() const
+  {
+    Decoder d;
+    d.words = m_words.data();
+    d.rank = m_rank.data();
+    d.num_words = m_words.size();
+    d.first = m_first;
+    return d;
+  }
+
+  detail::CompressedListData<uint64_t> m_words;
+  detail::CompressedListData<Index_type> m_rank;
+  value_type m_first;
+  Index_type m_size;
+};
+
+//! alias for a TypedBitmaskSegment with storage type @Index_type
+using BitmaskSegment = TypedBitmaskSegment<Index_type>;
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_bitmask_segment
+    : ::RAJA::type_traits::SpecializationOf<RAJA::TypedBitmaskSegment,
+                                            typename std::decay<T>::type> {
+};
+
+}  // namespace type_traits
+
+namespace detail
+{
+
+//! loop body that visits the indices of seg word by word
+template <typename T, typename Body>
+BitmaskWordBody<T, typename std::decay<Body>::type> make_bitmask_word_body(
+    TypedBitmaskSegment<T> const& seg,
+    Body&& body)
+{
+  return {seg.getWords(), seg.getFirst(), std::forward<Body>(body)};
+}
+
+//! loop body that visits the indices of seg word by word with icount
+template <typename IndexT, typename T, typename Body>
+BitmaskWordIcountBody<T, IndexT, typename std::decay<Body>::type>
+make_bitmask_word_icount_body(TypedBitmaskSegment<T> const& seg,
+                              Index_type icount,
+                              Body&& body)
+{
+  return {seg.getWords(),
+          seg.getWordRanks(),
+          seg.getFirst(),
+          icount,
+          std::forward<Body>(body)};
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+namespace std
+{
+
+/*!
+ *  Specialization of std::swap for TypedBitmaskSegment
+ */
+template <typename T>
+RAJA_INLINE void swap(RAJA::TypedBitmaskSegment<T>& a,
+                      RAJA::TypedBitmaskSegment<T>& b)
+{
+  a.swap(b);
+}
+
+}  // namespace std
+
+#endif  // closing endif for header file include guard
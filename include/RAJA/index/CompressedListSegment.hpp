@@ -0,0 +1,768 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining compressed list segment classes.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_CompressedListSegment_HPP
+#define RAJA_CompressedListSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Random access iterator over a compressed list of indices.
+ *
+ *         The iterator holds a position and a decoder that gives the index
+ *         at any position, so it is as cheap to copy and offset as a
+ *         pointer and indices are decoded inside the loop that uses them.
+ *
+ ******************************************************************************
+ */
+template <typename Decoder>
+class CompressedListIterator
+{
+public:
+  using value_type = typename Decoder::value_type;
+  using difference_type = Index_type;
+  using pointer = value_type*;
+  using reference = value_type;
+  using iterator_category = std::random_access_iterator_tag;
+
+  RAJA_HOST_DEVICE constexpr CompressedListIterator() : m_decoder(), m_pos(0)
+  {
+  }
+
+  RAJA_HOST_DEVICE constexpr CompressedListIterator(Decoder decoder,
+                                                    difference_type pos)
+      : m_decoder(decoder), m_pos(pos)
+  {
+  }
+
+  RAJA_HOST_DEVICE inline bool operator==(
+      const CompressedListIterator& rhs) const
+  {
+    return m_pos == rhs.m_pos;
+  }
+  RAJA_HOST_DEVICE inline bool operator!=(
+      const CompressedListIterator& rhs) const
+  {
+    return m_pos != rhs.m_pos;
+  }
+  RAJA_HOST_DEVICE inline bool operator<(
+      const CompressedListIterator& rhs) const
+  {
+    return m_pos < rhs.m_pos;
+  }
+  RAJA_HOST_DEVICE inline bool operator>(
+      const CompressedListIterator& rhs) const
+  {
+    return m_pos > rhs.m_pos;
+  }
+  RAJA_HOST_DEVICE inline bool operator<=(
+      const CompressedListIterator& rhs) const
+  {
+    return m_pos <= rhs.m_pos;
+  }
+  RAJA_HOST_DEVICE inline bool operator>=(
+      const CompressedListIterator& rhs) const
+  {
+    return m_pos >= rhs.m_pos;
+  }
+
+  RAJA_HOST_DEVICE inline CompressedListIterator& operator++()
+  {
+    ++m_pos;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline CompressedListIterator& operator--()
+  {
+    --m_pos;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline CompressedListIterator operator++(int)
+  {
+    CompressedListIterator tmp(*this);
+    ++m_pos;
+    return tmp;
+  }
+  RAJA_HOST_DEVICE inline CompressedListIterator operator--(int)
+  {
+    CompressedListIterator tmp(*this);
+    --m_pos;
+    return tmp;
+  }
+
+  RAJA_HOST_DEVICE inline CompressedListIterator& operator+=(
+      difference_type rhs)
+  {
+    m_pos += rhs;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline CompressedListIterator& operator-=(
+      difference_type rhs)
+  {
+    m_pos -= rhs;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE inline CompressedListIterator operator+(
+      difference_type rhs) const
+  {
+    return CompressedListIterator(m_decoder, m_pos + rhs);
+  }
+  RAJA_HOST_DEVICE inline CompressedListIterator operator-(
+      difference_type rhs) const
+  {
+    return CompressedListIterator(m_decoder, m_pos - rhs);
+  }
+  RAJA_HOST_DEVICE friend inline CompressedListIterator operator+(
+      difference_type lhs,
+      const CompressedListIterator& rhs)
+  {
+    return rhs + lhs;
+  }
+  RAJA_HOST_DEVICE inline difference_type operator-(
+      const CompressedListIterator& rhs) const
+  {
+    return m_pos - rhs.m_pos;
+  }
+
+  RAJA_HOST_DEVICE inline value_type operator*() const
+  {
+    return m_decoder(m_pos);
+  }
+  RAJA_HOST_DEVICE inline value_type operator[](difference_type rhs) const
+  {
+    return m_decoder(m_pos + rhs);
+  }
+
+private:
+  Decoder m_decoder;
+  difference_type m_pos;
+};
+
+/*!
+ * \brief  Array of n objects allocated with a camp resource and filled
+ *         from host memory. Copies are deep and use the same resource.
+ */
+template <typename T>
+class CompressedListData
+{
+public:
+  CompressedListData(camp::resources::Resource& resource,
+                     const T* host_data,
+                     Index_type n)
+      : m_resource(resource), m_data(nullptr), m_size(n)
+  {
+    if (m_size > 0) {
+      m_data = m_resource.allocate<T>(m_size);
+      m_resource.memcpy(m_data, host_data, sizeof(T) * m_size);
+    }
+  }
+
+  CompressedListData(const CompressedListData& other)
+      : m_resource(other.m_resource), m_data(nullptr), m_size(other.m_size)
+  {
+    if (m_size > 0) {
+      m_data = m_resource.allocate<T>(m_size);
+      m_resource.memcpy(m_data, other.m_data, sizeof(T) * m_size);
+    }
+  }
+
+  CompressedListData(CompressedListData&& other)
+      : m_resource(other.m_resource),
+        m_data(other.m_data),
+        m_size(other.m_size)
+  {
+    other.m_data = nullptr;
+    other.m_size = 0;
+  }
+
+  CompressedListData& operator=(CompressedListData other)
+  {
+    swap(other);
+    return *this;
+  }
+
+  ~CompressedListData()
+  {
+    if (m_data != nullptr) {
+      m_resource.deallocate(m_data);
+    }
+  }
+
+  void swap(CompressedListData& other)
+  {
+    camp::safe_swap(m_resource, other.m_resource);
+    camp::safe_swap(m_data, other.m_data);
+    camp::safe_swap(m_size, other.m_size);
+  }
+
+  RAJA_HOST_DEVICE const T* data() const { return m_data; }
+
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+private:
+  camp::resources::Resource m_resource;
+  T* m_data;
+  Index_type m_size;
+};
+
+//! gives the index at a position of a TypedDeltaListSegment
+template <typename T>
+struct DeltaListDecoder {
+  using value_type = T;
+
+  static constexpr int block_shift = 6;
+
+  const T* bases = nullptr;
+  const uint16_t* deltas = nullptr;
+
+  RAJA_HOST_DEVICE inline value_type operator()(Index_type pos) const
+  {
+    return static_cast<value_type>(bases[pos >> block_shift] + deltas[pos]);
+  }
+};
+
+//! gives the index at a position of a TypedRunListSegment
+template <typename T>
+struct RunListDecoder {
+  using value_type = T;
+
+  static constexpr int sample_shift = 6;
+
+  const T* run_begin = nullptr;
+  const Index_type* run_pos = nullptr;
+  const Index_type* run_sample = nullptr;
+
+  RAJA_HOST_DEVICE inline value_type operator()(Index_type pos) const
+  {
+    // the run holding pos is between the runs holding the samples around it
+    Index_type lo = run_sample[pos >> sample_shift];
+    Index_type hi = run_sample[(pos >> sample_shift) + 1];
+    while (lo < hi) {
+      const Index_type mid = (lo + hi + 1) / 2;
+      if (run_pos[mid] <= pos) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
+      }
+    }
+    return static_cast<value_type>(run_begin[lo] + (pos - run_pos[lo]));
+  }
+};
+
+//! loop body over the runs of a TypedRunListSegment
+template <typename T, typename Body>
+struct RunListRunBody {
+  const T* run_begin;
+  const Index_type* run_pos;
+  Body body;
+
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE void operator()(Index_type r) const
+  {
+    const T first = run_begin[r];
+    const Index_type len = run_pos[r + 1] - run_pos[r];
+    for (Index_type k = 0; k < len; ++k) {
+      body(static_cast<T>(first + k));
+    }
+  }
+};
+
+//! loop body over the runs of a TypedRunListSegment with icount
+template <typename T, typename IndexT, typename Body>
+struct RunListRunIcountBody {
+  const T* run_begin;
+  const Index_type* run_pos;
+  Index_type icount;
+  Body body;
+
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE void operator()(Index_type r) const
+  {
+    const T first = run_begin[r];
+    const Index_type i0 = icount + run_pos[r];
+    const Index_type len = run_pos[r + 1] - run_pos[r];
+    for (Index_type k = 0; k < len; ++k) {
+      body(static_cast<IndexT>(i0 + k), static_cast<T>(first + k));
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class representing an arbitrary collection of indices stored as
+ *         16-bit deltas.
+ *
+ *         The indices are split into blocks of 64. Each block stores its
+ *         smallest index, and each index is stored as its distance from the
+ *         smallest index of its block, which must fit in 16 bits. Nearly
+ *         sorted lists take a little over 2 bytes per index instead of
+ *         sizeof(T), and the segment can be used anywhere a
+ *         TypedListSegment can.
+ *
+ *         Traversal executes as:
+ *            for (i = 0; i < getLength(); ++i) {
+ *               expression using base[i / 64] + delta[i] as array index.
+ *            }
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class TypedDeltaListSegment
+{
+  static_assert(std::is_integral<T>::value,
+                "TypedDeltaListSegment index type must be integral");
+
+  using Decoder = detail::DeltaListDecoder<T>;
+
+  static constexpr Index_type s_block_size = Index_type(1)
+                                             << Decoder::block_shift;
+
+  //! a list of indices as it is stored by the segment
+  struct Blocks {
+    std::vector<T> bases;
+    std::vector<uint16_t> deltas;
+  };
+
+public:
+  //! value type for storage
+  using value_type = T;
+
+  //! iterator type that decodes indices
+  using iterator = detail::CompressedListIterator<Decoder>;
+
+  //! expose underlying index type
+  using IndexType = RAJA::Index_type;
+
+  //! prevent compiler from providing a default constructor
+  TypedDeltaListSegment() = delete;
+
+  ///
+  /// \brief Construct segment from given array with specified length and
+  ///        use given camp resource to allocate the encoded index data.
+  ///
+  /// Aborts or throws if the indices cannot be encoded; see encodable().
+  ///
+  TypedDeltaListSegment(const value_type* values,
+                        Index_type length,
+                        camp::resources::Resource& resource)
+      : TypedDeltaListSegment(encodeBlocks(values, length), length, resource)
+  {
+  }
+
+  ///
+  /// \brief Construct segment from given array with specified length in
+  ///        host memory.
+  ///
+  TypedDeltaListSegment(const value_type* values, Index_type length)
+      : TypedDeltaListSegment(values, length, hostResource())
+  {
+  }
+
+  ///
+  /// \brief Returns true if the indices in values fit the encoding: in
+  ///        every block of 64, the largest index is less than 65536 more
+  ///        than the smallest.
+  ///
+  static bool encodable(const value_type* values, Index_type length)
+  {
+    for (Index_type b = 0; b < numBlocks(length); ++b) {
+      const value_type* first = values + b * s_block_size;
+      const value_type* last = values + blockEnd(b, length);
+      const auto lo = *std::min_element(first, last);
+      const auto hi = *std::max_element(first, last);
+      if (static_cast<uint64_t>(hi) - static_cast<uint64_t>(lo) > 0xFFFFu) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  ///
+  /// Swap function for copy-and-swap idiom.
+  ///
+  void swap(TypedDeltaListSegment& other)
+  {
+    m_bases.swap(other.m_bases);
+    m_deltas.swap(other.m_deltas);
+    camp::safe_swap(m_size, other.m_size);
+  }
+
+  //! accessor to get the begin iterator for a TypedDeltaListSegment
+  RAJA_HOST_DEVICE iterator begin() const { return iterator(decoder(), 0); }
+
+  //! accessor to get the end iterator for a TypedDeltaListSegment
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(decoder(), m_size);
+  }
+
+  //! accessor to retrieve the total number of elements in the segment
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  ///
+  /// Equality operator returns true if segments hold the same indices.
+  ///
+  bool operator==(const TypedDeltaListSegment& other) const
+  {
+    return m_size == other.m_size
+           && std::equal(begin(), end(), other.begin());
+  }
+
+  ///
+  /// Inequality operator returns true if segments are not equal, else false.
+  ///
+  bool operator!=(const TypedDeltaListSegment& other) const
+  {
+    return !(*this == other);
+  }
+
+private:
+  TypedDeltaListSegment(Blocks const& blocks,
+                        Index_type length,
+                        camp::resources::Resource& resource)
+      : m_bases(resource, blocks.bases.data(), blocks.bases.size()),
+        m_deltas(resource, blocks.deltas.data(), length),
+        m_size(length)
+  {
+  }
+
+  static camp::resources::Resource& hostResource()
+  {
+    static camp::resources::Resource host{camp::resources::Host()};
+    return host;
+  }
+
+  static Index_type numBlocks(Index_type length)
+  {
+    return (length + s_block_size - 1) / s_block_size;
+  }
+
+  static Index_type blockEnd(Index_type block, Index_type length)
+  {
+    return (block + 1) * s_block_size < length ? (block + 1) * s_block_size
+                                               : length;
+  }
+
+  static Blocks encodeBlocks(const value_type* values, Index_type length)
+  {
+    if (!encodable(values, length)) {
+      RAJA_ABORT_OR_THROW(
+          "TypedDeltaListSegment: index block spans more than 16 bits");
+    }
+    Blocks blocks;
+    blocks.deltas.resize(length);
+    for (Index_type b = 0; b < numBlocks(length); ++b) {
+      const Index_type i0 = b * s_block_size;
+      const Index_type i1 = blockEnd(b, length);
+      const value_type base = *std::min_element(values + i0, values + i1);
+      blocks.bases.push_back(base);
+      for (Index_type i = i0; i < i1; ++i) {
+        blocks.deltas[i] = static_cast<uint16_t>(values[i] - base);
+      }
+    }
+    return blocks;
+  }
+
+  RAJA_HOST_DEVICE Decoder decoder() const
+  {
+    Decoder d;
+    d.bases = m_bases.data();
+    d.deltas = m_deltas.data();
+    return d;
+  }
+
+  detail::CompressedListData<value_type> m_bases;
+  detail::CompressedListData<uint16_t> m_deltas;
+  Index_type m_size;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class representing an arbitrary collection of indices stored as
+ *         runs of consecutive indices.
+ *
+ *         Each run stores its first index and its position in the segment,
+ *         and lists made of long runs take far less memory than a
+ *         TypedListSegment. forall runs a loop over the runs with the given
+ *         policy, and each run visits its consecutive indices with no
+ *         decoding.
+ *
+ *         Every 64th position also stores the run that holds it, so the
+ *         iterators give random access by searching at most 64 runs, and
+ *         the segment can be used anywhere a TypedListSegment can.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class TypedRunListSegment
+{
+  static_assert(std::is_integral<T>::value,
+                "TypedRunListSegment index type must be integral");
+
+  using Decoder = detail::RunListDecoder<T>;
+
+  static constexpr Index_type s_sample_size = Index_type(1)
+                                              << Decoder::sample_shift;
+
+  //! runs of a list of indices, as they are stored by the segment
+  struct Runs {
+    std::vector<T> begin;
+    std::vector<Index_type> pos;
+    std::vector<Index_type> sample;
+  };
+
+public:
+  //! value type for storage
+  using value_type = T;
+
+  //! iterator type that decodes indices
+  using iterator = detail::CompressedListIterator<Decoder>;
+
+  //! expose underlying index type
+  using IndexType = RAJA::Index_type;
+
+  //! prevent compiler from providing a default constructor
+  TypedRunListSegment() = delete;
+
+  ///
+  /// \brief Construct segment from given array with specified length and
+  ///        use given camp resource to allocate the encoded index data.
+  ///
+  TypedRunListSegment(const value_type* values,
+                      Index_type length,
+                      camp::resources::Resource& resource)
+      : TypedRunListSegment(encodeRuns(values, length), length, resource)
+  {
+  }
+
+  ///
+  /// \brief Construct segment from given array with specified length in
+  ///        host memory.
+  ///
+  TypedRunListSegment(const value_type* values, Index_type length)
+      : TypedRunListSegment(values, length, hostResource())
+  {
+  }
+
+  ///
+  /// Swap function for copy-and-swap idiom.
+  ///
+  void swap(TypedRunListSegment& other)
+  {
+    m_run_begin.swap(other.m_run_begin);
+    m_run_pos.swap(other.m_run_pos);
+    m_run_sample.swap(other.m_run_sample);
+    camp::safe_swap(m_size, other.m_size);
+  }
+
+  //! accessor to get the begin iterator for a TypedRunListSegment
+  RAJA_HOST_DEVICE iterator begin() const { return iterator(decoder(), 0); }
+
+  //! accessor to get the end iterator for a TypedRunListSegment
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(decoder(), m_size);
+  }
+
+  //! accessor to retrieve the total number of elements in the segment
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  //! accessor to retrieve the number of runs in the segment
+  RAJA_HOST_DEVICE Index_type getNumRuns() const
+  {
+    return m_run_begin.size();
+  }
+
+  //! accessor to retrieve the first index of each run
+  RAJA_HOST_DEVICE const value_type* getRunBegins() const
+  {
+    return m_run_begin.data();
+  }
+
+  //! accessor to retrieve the position of each run, followed by size()
+  RAJA_HOST_DEVICE const Index_type* getRunPositions() const
+  {
+    return m_run_pos.data();
+  }
+
+  ///
+  /// Equality operator returns true if segments hold the same indices.
+  ///
+  bool operator==(const TypedRunListSegment& other) const
+  {
+    return m_size == other.m_size
+           && std::equal(begin(), end(), other.begin());
+  }
+
+  ///
+  /// Inequality operator returns true if segments are not equal, else false.
+  ///
+  bool operator!=(const TypedRunListSegment& other) const
+  {
+    return !(*this == other);
+  }
+
+private:
+  TypedRunListSegment(Runs const& runs,
+                      Index_type length,
+                      camp::resources::Resource& resource)
+      : m_run_begin(resource, runs.begin.data(), runs.begin.size()),
+        m_run_pos(resource, runs.pos.data(), runs.pos.size()),
+        m_run_sample(resource, runs.sample.data(), runs.sample.size()),
+        m_size(length)
+  {
+  }
+
+  static camp::resources::Resource& hostResource()
+  {
+    static camp::resources::Resource host{camp::resources::Host()};
+    return host;
+  }
+
+  static Runs encodeRuns(const value_type* values, Index_type length)
+  {
+    Runs runs;
+    for (Index_type i = 0; i < length; ++i) {
+      if (i == 0 || values[i] != values[i - 1] + 1) {
+        runs.begin.push_back(values[i]);
+        runs.pos.push_back(i);
+      }
+      if (i % s_sample_size == 0) {
+        runs.sample.push_back(runs.begin.size() - 1);
+      }
+    }
+    // bounds the search for positions after the last sample, and the
+    // last run
+    if (length > 0) {
+      runs.sample.push_back(runs.begin.size() - 1);
+      runs.pos.push_back(length);
+    }
+    return runs;
+  }
+
+  RAJA_HOST_DEVICE Decoder decoder() const
+  {
+    Decoder d;
+    d.run_begin = m_run_begin.data();
+    d.run_pos = m_run_pos.data();
+    d.run_sample = m_run_sample.data();
+    return d;
+  }
+
+  detail::CompressedListData<value_type> m_run_begin;
+  detail::CompressedListData<Index_type> m_run_pos;
+  detail::CompressedListData<Index_type> m_run_sample;
+  Index_type m_size;
+};
+
+//! alias for a TypedDeltaListSegment with storage type @Index_type
+using DeltaListSegment = TypedDeltaListSegment<Index_type>;
+
+//! alias for a TypedRunListSegment with storage type @Index_type
+using RunListSegment = TypedRunListSegment<Index_type>;
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_run_list_segment
+    : ::RAJA::type_traits::SpecializationOf<RAJA::TypedRunListSegment,
+                                            typename std::decay<T>::type> {
+};
+
+}  // namespace type_traits
+
+namespace detail
+{
+
+//! loop body that visits the indices of seg run by run
+template <typename T, typename Body>
+RunListRunBody<T, typename std::decay<Body>::type> make_run_list_body(
+    TypedRunListSegment<T> const& seg,
+    Body&& body)
+{
+  return {seg.getRunBegins(), seg.getRunPositions(), std::forward<Body>(body)};
+}
+
+//! loop body that visits the indices of seg run by run with icount
+template <typename IndexT, typename T, typename Body>
+RunListRunIcountBody<T, IndexT, typename std::decay<Body>::type>
+make_run_list_icount_body(TypedRunListSegment<T> const& seg,
+                          Index_type icount,
+                          Body&& body)
+{
+  return {seg.getRunBegins(),
+          seg.getRunPositions(),
+          icount,
+          std::forward<Body>(body)};
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+namespace std
+{
+
+/*!
+ *  Specialization of std::swap for TypedDeltaListSegment
+ */
+template <typename T>
+RAJA_INLINE void swap(RAJA::TypedDeltaListSegment<T>& a,
+                      RAJA::TypedDeltaListSegment<T>& b)
+{
+  a.swap(b);
+}
+
+/*!
+ *  Specialization of std::swap for TypedRunListSegment
+ */
+template <typename T>
+RAJA_INLINE void swap(RAJA::TypedRunListSegment<T>& a,
+                      RAJA::TypedRunListSegment<T>& b)
+{
+  a.swap(b);
+}
+
+}  // namespace std
+
+#endif  // closing endif for header file include guard
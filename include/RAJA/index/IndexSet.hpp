@@ -20,17 +20,25 @@
 
 #include "RAJA/config.hpp"
 
+#include <memory>
+
+#include "RAJA/index/BitmaskSegment.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
+#include "RAJA/internal/SegmentStorage.hpp"
 
 #include "RAJA/policy/PolicyBase.hpp"
 
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/concepts.hpp"
 
+#include "camp/list.hpp"
+
 namespace RAJA
 {
 
@@ -65,6 +73,37 @@ struct ExecPolicy
 
 using policy::indexset::ExecPolicy;
 
+namespace detail
+{
+
+//! calls body with the segment of type Seg at seg, then args
+template <typename Seg, typename Body, typename... Args>
+RAJA_INLINE void segment_call(void const *seg, Body &&body, Args &&... args)
+{
+  body(*static_cast<Seg const *>(seg), std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief  Table of segment_call instantiations for the segment types of an
+ *         index set, listed in the order of its template parameters.
+ */
+template <typename Body, typename ArgList, typename... Segs>
+struct segment_call_table;
+
+template <typename Body, typename... Args, typename... Segs>
+struct segment_call_table<Body, camp::list<Args...>, Segs...> {
+  using call_type = void (*)(void const *, Body &&, Args &&...);
+  static constexpr call_type value[sizeof...(Segs)] = {
+      &segment_call<Segs, Body, Args...>...};
+};
+
+template <typename Body, typename... Args, typename... Segs>
+constexpr typename segment_call_table<Body, camp::list<Args...>, Segs...>::
+    call_type segment_call_table<Body, camp::list<Args...>, Segs...>::value
+        [sizeof...(Segs)];
+
+}  // end namespace detail
+
 
 /*!
  ******************************************************************************
@@ -72,6 +111,11 @@ using policy::indexset::ExecPolicy;
  * \brief  Class representing an index set which is a collection
  *         of segment objects.
  *
+ *         Segments copied into the index set are stored by type in
+ *         contiguous chunks. The index set keeps one flat table with the
+ *         type, address and starting icount of every segment, so looking
+ *         up and dispatching on a segment takes constant time.
+ *
  ******************************************************************************
  */
 template <typename T0, typename... TREST>
@@ -97,18 +141,12 @@ public:
   RAJA_INLINE constexpr TypedIndexSet() : PARENT() {}
 #endif
 
-  //! Copy-constructor for index set
+  //! Copy-constructor for index set; the copy refers to the segments
+  //! of c and owns none of them.
   RAJA_INLINE
   TypedIndexSet(TypedIndexSet<T0, TREST...> const &c)
       : PARENT((PARENT const &)c)
   {
-    size_t num = c.data.size();
-    data.resize(num);
-    for (size_t i = 0; i < num; ++i) {
-      data[i] = c.data[i];
-    }
-    // mark all as not owned by us
-    owner.resize(num, 0);
   }
 
   //! Copy-assignment operator for index set
@@ -121,27 +159,13 @@ public:
     return *this;
   }
 
-  //! Destroy index set including all index set segments.
-  RAJA_INLINE ~TypedIndexSet()
-  {
-    size_t num_seg = data.size();
-    for (size_t i = 0; i < num_seg; ++i) {
-      // Only free segment of we allocated it
-      if (owner[i]) {
-        delete data[i];
-      }
-    }
-  }
-
   //! Swap function for copy-and-swap idiom.
   void swap(TypedIndexSet<T0, TREST...> &other)
   {
     // Swap parents data
     PARENT::swap((PARENT &)other);
     // Swap our data
-    using std::swap;
-    swap(data, other.data);
-    swap(owner, other.owner);
+    segments.swap(other.segments);
   }
 
   ///
@@ -166,8 +190,7 @@ public:
     }
 
     // Compare to others segid
-    Index_type offset = getSegmentOffsets()[segid];
-    return *data[offset] == other.template getSegment<T0>(segid);
+    return *segmentAt(segid) == other.template getSegment<T0>(segid);
   }
 
 
@@ -186,8 +209,7 @@ public:
   RAJA_INLINE P0 &getSegment(size_t segid)
   {
     if (getSegmentTypes()[segid] == T0_TypeId) {
-      Index_type offset = getSegmentOffsets()[segid];
-      return *reinterpret_cast<P0 const *>(data[offset]);
+      return *static_cast<P0 const *>(getSegmentData()[segid]);
     }
     return PARENT::template getSegment<P0>(segid);
   }
@@ -197,8 +219,7 @@ public:
   RAJA_INLINE P0 const &getSegment(size_t segid) const
   {
     if (getSegmentTypes()[segid] == T0_TypeId) {
-      Index_type offset = getSegmentOffsets()[segid];
-      return *reinterpret_cast<P0 const *>(data[offset]);
+      return *static_cast<P0 const *>(getSegmentData()[segid]);
     }
     return PARENT::template getSegment<P0>(segid);
   }
@@ -265,19 +286,19 @@ public:
       PARENT::segment_push_into(segid, c, pend, pcopy);
       return;
     }
-    Index_type offset = getSegmentOffsets()[segid];
+    T0 const *seg = segmentAt(segid);
     switch (value_for(pend, pcopy)) {
       case value_for(PUSH_BACK, PUSH_COPY):
-        c.push_back(*data[offset]);
+        c.push_back(*seg);
         break;
       case value_for(PUSH_BACK, PUSH_NOCOPY):
-        c.push_back_nocopy(data[offset]);
+        c.push_back_nocopy(seg);
         break;
       case value_for(PUSH_FRONT, PUSH_COPY):
-        c.push_front(*data[offset]);
+        c.push_front(*seg);
         break;
       case value_for(PUSH_FRONT, PUSH_NOCOPY):
-        c.push_front_nocopy(data[offset]);
+        c.push_front_nocopy(seg);
         break;
     }
   }
@@ -301,31 +322,23 @@ public:
   template <typename Tnew>
   RAJA_INLINE void push_back(Tnew const &val)
   {
-    push_internal(new Tnew(val), PUSH_BACK, PUSH_COPY);
+    push_internal(&val, PUSH_BACK, PUSH_COPY);
   }
 
   //! Add copy of segment to front end of index set.
   template <typename Tnew>
   RAJA_INLINE void push_front(Tnew const &val)
   {
-    push_internal(new Tnew(val), PUSH_FRONT, PUSH_COPY);
+    push_internal(&val, PUSH_FRONT, PUSH_COPY);
   }
 
   //! Return total length -- sum of lengths of all segments
-  RAJA_INLINE size_t getLength() const
-  {
-    size_t total = PARENT::getLength();
-    size_t num = data.size();
-    for (size_t i = 0; i < num; ++i) {
-      total += data[i]->size();
-    }
-    return total;
-  }
+  RAJA_INLINE size_t getLength() const { return getTotalLength(); }
 
   //! Return total number of segments in index set.
-  RAJA_INLINE constexpr size_t getNumSegments() const
+  RAJA_INLINE size_t getNumSegments() const
   {
-    return data.size() + PARENT::getNumSegments();
+    return getSegmentTypes().size();
   }
 
 
@@ -343,20 +356,19 @@ public:
                                     BODY &&body,
                                     ARGS &&... args) const
   {
-    if (getSegmentTypes()[segid] != T0_TypeId) {
-      PARENT::segmentCall(segid,
-                          std::forward<BODY>(body),
-                          std::forward<ARGS>(args)...);
-      return;
-    }
-    Index_type offset = getSegmentOffsets()[segid];
-    body(*data[offset], std::forward<ARGS>(args)...);
+    using table =
+        detail::segment_call_table<BODY, camp::list<ARGS...>, T0, TREST...>;
+    // type ids count down from T0
+    table::value[T0_TypeId - getSegmentTypes()[segid]](
+        getSegmentData()[segid],
+        std::forward<BODY>(body),
+        std::forward<ARGS>(args)...);
   }
 
 protected:
   //! Internal logic to add a new segment -- catch invalid type insertion
   template <typename Tnew>
-  RAJA_INLINE void push_internal(Tnew *val,
+  RAJA_INLINE void push_internal(Tnew const *val,
                                  PushEnd pend = PUSH_BACK,
                                  PushCopy pcopy = PUSH_COPY)
   {
@@ -365,20 +377,21 @@ protected:
   }
 
   //! Internal logic to add a new segment
-  RAJA_INLINE void push_internal(T0 *val,
+  RAJA_INLINE void push_internal(T0 const *val,
                                  PushEnd pend = PUSH_BACK,
                                  PushCopy pcopy = PUSH_COPY)
   {
-    data.push_back(val);
-    owner.push_back(pcopy == PUSH_COPY);
+    if (pcopy == PUSH_COPY) {
+      val = segments.emplace(*val);
+    }
 
     // Determine if we push at the front or back of the segment list
     if (pend == PUSH_BACK) {
       // Store the segment type
       getSegmentTypes().push_back(T0_TypeId);
 
-      // Store the segment offset in data[]
-      getSegmentOffsets().push_back(data.size() - 1);
+      // Store the segment address
+      getSegmentData().push_back(val);
 
       // Store the segment icount
       size_t icount = val->size();
@@ -388,8 +401,8 @@ protected:
       // Store the segment type
       getSegmentTypes().push_front(T0_TypeId);
 
-      // Store the segment offset in data[]
-      getSegmentOffsets().push_front(data.size() - 1);
+      // Store the segment address
+      getSegmentData().push_front(val);
 
       // Store the segment icount
       getSegmentIcounts().push_front(0);
@@ -404,6 +417,18 @@ protected:
   //! Returns the number of indices (the total icount of segments
   RAJA_INLINE Index_type &getTotalLength() { return PARENT::getTotalLength(); }
 
+  //! Returns the number of indices (the total icount of segments
+  RAJA_INLINE Index_type getTotalLength() const
+  {
+    return PARENT::getTotalLength();
+  }
+
+  //! Returns the segment with the given id, which must be of type T0
+  RAJA_INLINE T0 const *segmentAt(size_t segid) const
+  {
+    return static_cast<T0 const *>(getSegmentData()[segid]);
+  }
+
   //! set total length of the indexset
   RAJA_INLINE void setTotalLength(int n) { return PARENT::setTotalLength(n); }
 
@@ -488,6 +513,21 @@ public:
     return retVal;
   }
 
+  //!  @name TypedIndexSet dependency graph methods
+  ///
+  /// Create a dependency graph node for every segment currently in this
+  /// TypedIndexSet, none of which depend on another. Add dependencies
+  /// with getDependencyGraph()->addDependentTask() and then call
+  /// finalizeDependencyGraph() to run the segments with the
+  /// omp_taskgraph_segit and omp_taskgraph_interval_segit policies.
+  ///
+  /// The graph is shared with copies of this TypedIndexSet.
+  ///
+  void initDependencyGraph()
+  {
+    PARENT::setDependencyGraph(std::make_shared<DepGraph>(getNumSegments()));
+  }
+
   //! Set [begin, end) interval of segments identified by interval_id
   void setSegmentInterval(size_t interval_id, int begin, int end)
   {
@@ -520,16 +560,16 @@ protected:
     return PARENT::getSegmentTypes();
   }
 
-  //! Returns the mapping of  segment_index -> segment_offset
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentOffsets()
+  //! Returns the mapping of  segment_index -> segment address
+  RAJA_INLINE RAJA::RAJAVec<void const *> &getSegmentData()
   {
-    return PARENT::getSegmentOffsets();
+    return PARENT::getSegmentData();
   }
 
-  //! Returns the mapping of  segment_index -> segment_offset
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentOffsets() const
+  //! Returns the mapping of  segment_index -> segment address
+  RAJA_INLINE RAJA::RAJAVec<void const *> const &getSegmentData() const
   {
-    return PARENT::getSegmentOffsets();
+    return PARENT::getSegmentData();
   }
 
   //! Returns the icount of segments
@@ -573,11 +613,8 @@ public:
   }
 
 private:
-  //! vector of TypedIndexSet data objects of type T0
-  RAJA::RAJAVec<T0 *> data;
-
-  //! vector indicating which segments are owned by the TypedIndexSet
-  RAJA::RAJAVec<Index_type> owner;
+  //! segments of type T0 owned by the TypedIndexSet
+  RAJA::SegmentStorage<T0> segments;
 
   //! vector holding user defined begin segment intervals
   RAJA::RAJAVec<Index_type> m_seg_interval_begin;
@@ -606,9 +643,10 @@ public:
   TypedIndexSet(TypedIndexSet const &c)
   {
     segment_types = c.segment_types;
-    segment_offsets = c.segment_offsets;
+    segment_data = c.segment_data;
     segment_icounts = c.segment_icounts;
     m_len = c.m_len;
+    m_dep_graph = c.m_dep_graph;
   }
 
   //! Swap function for copy-and-swap idiom (deep copy).
@@ -616,11 +654,31 @@ public:
   {
     using std::swap;
     swap(segment_types, other.segment_types);
-    swap(segment_offsets, other.segment_offsets);
+    swap(segment_data, other.segment_data);
     swap(segment_icounts, other.segment_icounts);
     swap(m_len, other.m_len);
+    swap(m_dep_graph, other.m_dep_graph);
   }
 
+  //! Get the dependency graph node of the segment with the given id.
+  DepGraphNode *getDepGraphNode(int segid) const
+  {
+    return m_dep_graph->getNode(segid);
+  }
+
+  //! Compute the dependency counts of the graph after its dependent
+  //! tasks have been added; see DepGraph::finalize().
+  void finalizeDependencyGraph() { m_dep_graph->finalize(); }
+
+  //! True if a dependency graph has been created and finalized.
+  bool dependencyGraphSet() const
+  {
+    return m_dep_graph && m_dep_graph->isFinalized();
+  }
+
+  //! Get the dependency graph, or nullptr if there is none.
+  DepGraph *getDependencyGraph() const { return m_dep_graph.get(); }
+
 protected:
   RAJA_INLINE static size_t getNumTypes() { return 0; }
 
@@ -650,14 +708,14 @@ protected:
     return segment_types;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentOffsets()
+  RAJA_INLINE RAJA::RAJAVec<void const *> &getSegmentData()
   {
-    return segment_offsets;
+    return segment_data;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentOffsets() const
+  RAJA_INLINE RAJA::RAJAVec<void const *> const &getSegmentData() const
   {
-    return segment_offsets;
+    return segment_data;
   }
 
   RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentIcounts()
@@ -672,10 +730,17 @@ protected:
 
   RAJA_INLINE Index_type &getTotalLength() { return m_len; }
 
+  RAJA_INLINE Index_type getTotalLength() const { return m_len; }
+
   RAJA_INLINE void setTotalLength(int n) { m_len = n; }
 
   RAJA_INLINE void increaseTotalLength(int n) { m_len += n; }
 
+  RAJA_INLINE void setDependencyGraph(std::shared_ptr<DepGraph> graph)
+  {
+    m_dep_graph = std::move(graph);
+  }
+
   template <typename P0, typename... PREST>
   RAJA_INLINE bool compareSegmentById(size_t,
                                       const TypedIndexSet<P0, PREST...> &) const
@@ -745,15 +810,17 @@ private:
   //! Vector of segment types:    seg_index -> seg_type
   RAJA::RAJAVec<Index_type> segment_types;
 
-  //! offsets into each segment vector:    seg_index -> seg_offset
-  //! used as segment_data[seg_type][seg_offset]
-  RAJA::RAJAVec<Index_type> segment_offsets;
+  //! Vector of segment addresses:    seg_index -> segment
+  RAJA::RAJAVec<void const *> segment_data;
 
   //! the icount of each segment
   RAJA::RAJAVec<Index_type> segment_icounts;
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
+
+  //! Segment dependency graph, shared by copies of the TypedIndexSet
+  std::shared_ptr<DepGraph> m_dep_graph;
 };
 
 
@@ -50,6 +50,25 @@ void buildTypedIndexSetAligned(
     const Index_type* const indices_in,
     Index_type length);
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Initialize index set with aligned Ranges and List segments from
+ *        array of indices with given length, using all OpenMP threads.
+ *
+ *        Gives the same segments as buildTypedIndexSetAligned. Each thread
+ *        finds the ranges in one block of the array, and ranges that cross
+ *        blocks are joined.
+ *
+ * Note: Method assumes TypedIndexSet reference refers to an empty index set.
+ *
+ ******************************************************************************
+ */
+void buildTypedIndexSetAlignedParallel(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& hiset,
+    const Index_type* const indices_in,
+    Index_type length);
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -69,7 +88,11 @@ void buildTypedIndexSetAligned(
  * Initialize lock-free "block" index set (planar division).
  *
  * The method chunks a fastDim x midDim x slowDim mesh into blocks that can
- * be dependency-scheduled, removing need for lock constructs.
+ * be dependency-scheduled, removing need for lock constructs. When the mesh
+ * is split, the index set gets a dependency graph under which neighboring
+ * blocks never run at the same time, and every block is at least two rows
+ * (planes in 3d) thick, so a stencil reaching one row either way is safe;
+ * run it with omp_taskgraph_segit or omp_taskgraph_interval_segit.
  *
  * Note: Method assumes TypedIndexSet reference refers to an empty index set.
  *
@@ -79,9 +102,9 @@ void buildLockFreeBlockIndexset(
     RAJA::TypedIndexSet<RAJA::RangeSegment,
                         RAJA::ListSegment,
                         RAJA::RangeStrideSegment>& iset,
-    int fastDim,
-    int midDim,
-    int slowDim);
+    Index_type fastDim,
+    Index_type midDim,
+    Index_type slowDim);
 
 /*
  ******************************************************************************
@@ -105,6 +128,33 @@ void buildLockFreeColorIndexset(
     Index_type* elemPermutation = 0l,
     Index_type* ielemPermutation = 0l);
 
+/*
+ ******************************************************************************
+ *
+ * Build Lock-free "color" index set in parallel. Takes the same arguments
+ * as buildLockFreeColorIndexset and gives an index set with the same
+ * properties, but colors the domain-set with speculative greedy coloring
+ * using all OpenMP threads, then moves domains between colors until every
+ * color has about the same number of domains. Domains in each color are in
+ * increasing order, so a color is a RangeSegment when its domains are
+ * contiguous and a ListSegment otherwise. When elemPermutation is given,
+ * every color is a RangeSegment over the permuted domains.
+ *
+ * Note: Method assumes TypedIndexSet reference refers to an empty index set.
+ *
+ ******************************************************************************
+ */
+void buildParallelColorIndexset(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::RangeStrideSegment>& iset,
+    Index_type const* domainToRange,
+    int numEntity,
+    int numRangePerDomain,
+    int numEntityRange,
+    Index_type* elemPermutation = 0l,
+    Index_type* ielemPermutation = 0l);
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
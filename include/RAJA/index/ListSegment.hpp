@@ -225,6 +225,25 @@ public:
                   values, length, owned);
   }
 
+  ///
+  /// \brief Construct list segment of given length and use given camp
+  ///        resource to allocate its index data, which is not initialized.
+  ///
+  /// The caller writes the indices through begin() before the segment is
+  /// used, directly when the resource memory is host accessible and with
+  /// the resource's memcpy otherwise.
+  ///
+  TypedListSegment(camp::resources::Resource& resource, Index_type length)
+    : m_resource(resource), m_use_resource(true),
+      m_owned(Unowned), m_data(nullptr), m_size(0)
+  {
+    if (length > 0) {
+      m_data = m_resource.allocate<value_type>(length);
+      m_size = length;
+      m_owned = Owned;
+    }
+  }
+
   ///
   /// Construct list segment from arbitrary object holding
   /// indices using a deep copy of given data.
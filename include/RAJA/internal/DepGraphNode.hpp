@@ -24,7 +24,8 @@
 #include <atomic>
 #include <cstdlib>
 #include <iosfwd>
-#include <thread>
+#include <utility>
+#include <vector>
 
 #include "RAJA/util/types.hpp"
 
@@ -37,26 +38,29 @@ namespace RAJA
  * \brief  Class defining a simple semephore-based data structure for
  *         managing a node in a dependency graph.
  *
+ *         Nodes are created and wired up by a DepGraph, which stores the
+ *         dependent tasks of all its nodes in one contiguous array, so a
+ *         node may have any number of them.
+ *
  ******************************************************************************
  */
 class RAJA_ALIGNED_ATTR(256) DepGraphNode
 {
 public:
   ///
-  /// Constants for total number of allowable dependent tasks
-  /// and alignment of semaphore value (should match cache
-  /// coherence page size?).
-  ///
-  /// These values may need to be set differently for different
-  /// algorithms and platforms. We haven't determined the best defaults yet!
+  /// Number of times wait() checks the semaphore before it blocks.
   ///
-  static const int _MaxDepTasks_ = 8;
+  static const int _WaitSpins_ = 1024;
 
   ///
   /// Default ctor initializes node to default state.
   ///
   DepGraphNode()
-      : m_num_dep_tasks(0), m_semaphore_reload_value(0), m_semaphore_value(0)
+      : m_dep_task(nullptr),
+        m_num_dep_tasks(0),
+        m_semaphore_reload_value(0),
+        m_semaphore_value(0),
+        m_num_waiters(0)
   {
   }
 
@@ -67,10 +71,10 @@ public:
   std::atomic<int>& semaphoreValue() { return m_semaphore_value; }
 
   ///
-  /// Get/set semaphore "reload" value; i.e., the total number of external
+  /// Get semaphore "reload" value; i.e., the total number of external
   /// task dependencies that must be satisfied before this task can execute.
   ///
-  int& semaphoreReloadValue() { return m_semaphore_reload_value; }
+  int semaphoreReloadValue() const { return m_semaphore_reload_value; }
 
   ///
   /// Ready this task to be used again
@@ -78,39 +82,47 @@ public:
   void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Satisfy one incoming dependency. Returns true for the call that
+  /// satisfies the last one, i.e., when this task becomes ready to run,
+  /// and wakes any threads blocked in wait().
   ///
-  void satisfyOne()
+  bool satisfyOne()
   {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
+    if (m_semaphore_value.fetch_sub(1) != 1) {
+      return false;
     }
+    if (m_num_waiters.load() > 0) {
+      wakeWaiters();
+    }
+    return true;
   }
 
   ///
-  /// Wait for all dependencies to be satisfied
+  /// Wait for all dependencies to be satisfied. Short waits spin on the
+  /// semaphore; longer ones block the thread until satisfyOne() wakes it.
   ///
   void wait()
   {
-    while (m_semaphore_value > 0) {
-      // TODO: an efficient wait would be better here, but the standard
-      // promise/future is not good enough
-      std::this_thread::yield();
+    for (int spins = 0; spins < _WaitSpins_; ++spins) {
+      if (m_semaphore_value.load(std::memory_order_acquire) <= 0) {
+        return;
+      }
     }
+    waitBlocking();
   }
 
   ///
-  /// Get/set the number of "forward-dependencies" for this task; i.e., the
+  /// Get the number of "forward-dependencies" for this task; i.e., the
   /// number of external tasks that cannot execute until this task completes.
   ///
-  int& numDepTasks() { return m_num_dep_tasks; }
+  int numDepTasks() const { return m_num_dep_tasks; }
 
   ///
-  /// Get/set the forward dependency task number associated with the given
+  /// Get the forward dependency task number associated with the given
   /// index for this task. This is used to notify the appropriate external
   /// dependencies when this task completes.
   ///
-  int& depTaskNum(int tidx) { return m_dep_task[tidx]; }
+  int depTaskNum(int tidx) const { return m_dep_task[tidx]; }
 
   ///
   /// Print task graph object node data to given output stream.
@@ -118,10 +130,115 @@ public:
   void print(std::ostream& os) const;
 
 private:
-  int m_dep_task[_MaxDepTasks_];
+  friend class DepGraph;
+
+  void waitBlocking();
+  void wakeWaiters();
+
+  const int* m_dep_task;
   int m_num_dep_tasks;
   int m_semaphore_reload_value;
   std::atomic<int> m_semaphore_value;
+  std::atomic<int> m_num_waiters;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class holding one dependency graph node per segment of an index
+ *         set.
+ *
+ *         Dependencies must point forward: every dependent task of a node
+ *         must have a larger node number. This makes the graph acyclic and
+ *         lets a thread that runs a contiguous interval of segments in order
+ *         wait on each of them without deadlock.
+ *
+ ******************************************************************************
+ */
+class DepGraph
+{
+public:
+  ///
+  /// Create a graph of num_nodes nodes without dependencies.
+  ///
+  explicit DepGraph(int num_nodes);
+
+  ~DepGraph();
+
+  DepGraph(DepGraph const&) = delete;
+  DepGraph& operator=(DepGraph const&) = delete;
+
+  ///
+  /// Number of nodes in the graph.
+  ///
+  int size() const { return m_num_nodes; }
+
+  ///
+  /// Get the node with the given number.
+  ///
+  DepGraphNode* getNode(int node) const { return m_nodes + node; }
+
+  ///
+  /// Make dep_node wait for node to complete. Aborts unless
+  /// 0 <= node < dep_node < size(). Takes effect at the next finalize().
+  ///
+  void addDependentTask(int node, int dep_node);
+
+  ///
+  /// Store the dependent tasks of every node contiguously and set the
+  /// semaphore reload value of every node to the number of nodes that
+  /// list it as a dependent task.
+  ///
+  void finalize();
+
+  ///
+  /// True once finalize() has been called after the last dependency was
+  /// added.
+  ///
+  bool isFinalized() const { return m_finalized; }
+
+  ///
+  /// Ready every node for another execution of the graph.
+  ///
+  void reset() const
+  {
+    for (int i = 0; i < m_num_nodes; ++i) {
+      m_nodes[i].reset();
+    }
+  }
+
+  ///
+  /// Satisfy one dependency of every dependent task of the given node,
+  /// which has completed, and call ready(dep_node) for each one that
+  /// becomes ready to run; e.g., to push it onto a work queue.
+  ///
+  template <typename ReadyFunc>
+  void complete(int node, ReadyFunc&& ready) const
+  {
+    DepGraphNode const& task = m_nodes[node];
+    for (int ii = 0; ii < task.numDepTasks(); ++ii) {
+      const int dep = task.depTaskNum(ii);
+      if (m_nodes[dep].satisfyOne()) {
+        ready(dep);
+      }
+    }
+  }
+
+  ///
+  /// Print every node of the graph to given output stream.
+  ///
+  void print(std::ostream& os) const;
+
+private:
+  DepGraphNode* m_nodes;
+  int m_num_nodes;
+  bool m_finalized;
+
+  //! (node, dependent task) pairs in the order they were added
+  std::vector<std::pair<int, int>> m_edges;
+
+  //! dependent tasks of all nodes, grouped by node
+  std::vector<int> m_dep_tasks;
 };
 
 }  // namespace RAJA
@@ -0,0 +1,116 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for the class template that stores the
+ *          segments of one type owned by a TypedIndexSet.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SegmentStorage_HPP
+#define RAJA_SegmentStorage_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class template that stores objects of one type contiguously in
+ *         chunks that double in size.
+ *
+ *         Objects are constructed in place and never move, so pointers to
+ *         them stay valid as more are added; index sets and their slices
+ *         refer to segments by pointer. Adding an object only allocates
+ *         when the last chunk is full.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class SegmentStorage
+{
+public:
+  SegmentStorage() : m_chunks{}, m_num_chunks(0), m_chunk_used(0) {}
+
+  SegmentStorage(SegmentStorage const&) = delete;
+  SegmentStorage& operator=(SegmentStorage const&) = delete;
+
+  ///
+  /// Destroy all objects and free their storage.
+  ///
+  ~SegmentStorage()
+  {
+    for (int c = 0; c < m_num_chunks; ++c) {
+      const size_t used =
+          (c == m_num_chunks - 1) ? m_chunk_used : chunkCapacity(c);
+      for (size_t i = 0; i < used; ++i) {
+        m_chunks[c][i].~T();
+      }
+      ::operator delete(m_chunks[c]);
+    }
+  }
+
+  ///
+  /// Swap function for copy-and-swap idiom.
+  ///
+  void swap(SegmentStorage& other)
+  {
+    using std::swap;
+    swap(m_chunks, other.m_chunks);
+    swap(m_num_chunks, other.m_num_chunks);
+    swap(m_chunk_used, other.m_chunk_used);
+  }
+
+  ///
+  /// Construct a new object from the given arguments and return a pointer
+  /// to it.
+  ///
+  template <typename... Args>
+  T* emplace(Args&&... args)
+  {
+    if (m_num_chunks == 0
+        || m_chunk_used == chunkCapacity(m_num_chunks - 1)) {
+      m_chunks[m_num_chunks] = static_cast<T*>(
+          ::operator new(chunkCapacity(m_num_chunks) * sizeof(T)));
+      ++m_num_chunks;
+      m_chunk_used = 0;
+    }
+    T* obj = new (m_chunks[m_num_chunks - 1] + m_chunk_used)
+        T(std::forward<Args>(args)...);
+    ++m_chunk_used;
+    return obj;
+  }
+
+private:
+  //
+  // Chunk c holds s_first_chunk << c objects, so s_max_chunks chunks hold
+  // more objects than can be addressed.
+  //
+  static constexpr size_t s_first_chunk = 16;
+  static constexpr int s_max_chunks = 8 * sizeof(size_t) - 4;
+
+  static size_t chunkCapacity(int chunk) { return s_first_chunk << chunk; }
+
+  T* m_chunks[s_max_chunks];
+  int m_num_chunks;
+  size_t m_chunk_used;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
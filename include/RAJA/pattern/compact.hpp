@@ -0,0 +1,341 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA copy_if, partition and unique
+*          declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_HPP
+#define RAJA_compact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+#include "camp/resource.hpp"
+
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/Operators.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Iter>
+using CompactIterVal = camp::decay<decltype(*camp::val<Iter>())>;
+
+template <typename Container>
+using CompactContainerVal =
+    camp::decay<decltype(*camp::val<camp::iterator_from<Container>>())>;
+
+template <typename Container>
+using CompactContainerIter = camp::iterator_from<Container>;
+
+}  // end namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  copy_if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range, which must have room for every element of [begin, end)
+* \param[in] pred predicate selecting the elements to copy
+*
+* \return iterator to the end of the copied elements
+*
+* \note{Copied elements keep their input order. The output range must not
+*overlap the input range}
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename IterOut, typename Pred>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        IterOut>::type
+copy_if(const ExecPolicy &p, Iter begin, Iter end, IterOut out, Pred pred)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return out;
+  }
+  return out + impl::compact::copy_if(p, begin, end, out, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partition execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred predicate selecting the elements to move to the front
+*
+* \return iterator to the first element that does not satisfy pred
+*
+* \note{The partition is stable: both groups keep their input order}
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Pred>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        Iter>::type
+partition(const ExecPolicy &p, Iter begin, Iter end, Pred pred)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return begin;
+  }
+  return begin + impl::compact::partition(p, begin, end, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] eq equality function applied to adjacent elements
+*
+* \return iterator to the end of the elements kept
+*
+* \note{Keeps the first element of every run of adjacent equal elements}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Equal = operators::equal_to<detail::CompactIterVal<Iter>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        Iter>::type
+unique(const ExecPolicy &p, Iter begin, Iter end, Equal eq = Equal{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return begin;
+  }
+  return begin + impl::compact::unique(p, begin, end, eq);
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  copy_if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range, which must have room for every element of c
+* \param[in] pred predicate selecting the elements to copy
+*
+* \return iterator to the end of the copied elements
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename Pred>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        IterOut>::type
+copy_if(const ExecPolicy &p, const Container &c, IterOut out, Pred pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (std::begin(c) == std::end(c)) {
+    return out;
+  }
+  return out + impl::compact::copy_if(p, std::begin(c), std::end(c), out, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partition execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] pred predicate selecting the elements to move to the front
+*
+* \return iterator to the first element that does not satisfy pred
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename Pred>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        detail::CompactContainerIter<Container>>::type
+partition(const ExecPolicy &p, Container &c, Pred pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  if (std::begin(c) == std::end(c)) {
+    return std::begin(c);
+  }
+  return std::begin(c)
+         + impl::compact::partition(p, std::begin(c), std::end(c), pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] eq equality function applied to adjacent elements
+*
+* \return iterator to the end of the elements kept
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Equal =
+              operators::equal_to<detail::CompactContainerVal<Container>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        detail::CompactContainerIter<Container>>::type
+unique(const ExecPolicy &p, Container &c, Equal eq = Equal{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  if (std::begin(c) == std::end(c)) {
+    return std::begin(c);
+  }
+  return std::begin(c)
+         + impl::compact::unique(p, std::begin(c), std::end(c), eq);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Builds a list segment of the indices of a segment that satisfy
+*         a predicate, in order, with a parallel copy_if.
+*
+* \param[in] p Execution policy
+* \param[in] seg Random-Access segment or container of indices
+* \param[in] pred predicate selecting the indices to keep
+* \param[in] resource camp resource used to allocate the list segment data
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename Pred>
+typename std::enable_if<
+    type_traits::is_execution_policy<ExecPolicy>::value
+        && type_traits::is_range<Container>::value,
+    TypedListSegment<detail::CompactContainerVal<Container>>>::type
+make_list_segment_if(const ExecPolicy &p,
+                     const Container &seg,
+                     Pred pred,
+                     camp::resources::Resource &resource)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  using T = detail::CompactContainerVal<Container>;
+
+  TypedListSegment<T> list(resource, 0);
+  if (std::begin(seg) == std::end(seg)) {
+    return list;
+  }
+
+  // the indices are scattered straight into the segment data, which is
+  // allocated at its final length once the selected indices are counted;
+  // only memory the host cannot write goes through a host buffer
+  const bool host_data =
+      resource.get_platform() == camp::resources::Platform::host;
+  camp::resources::Resource host_res{camp::resources::Host()};
+  T *host_buf = nullptr;
+
+  const Index_type len = static_cast<Index_type>(impl::compact::copy_if_alloc(
+      p,
+      std::begin(seg),
+      std::end(seg),
+      [&](Index_type count) -> T * {
+        TypedListSegment<T> sized(resource, count);
+        list.swap(sized);
+        if (!host_data && count > 0) {
+          host_buf = host_res.allocate<T>(count);
+          return host_buf;
+        }
+        return list.begin();
+      },
+      pred));
+
+  if (host_buf != nullptr) {
+    resource.memcpy(list.begin(), host_buf, sizeof(T) * len);
+    host_res.deallocate(host_buf);
+  }
+  return list;
+}
+
+template <typename ExecPolicy, typename... Args>
+auto copy_if(Args &&... args)
+    -> decltype(::RAJA::copy_if(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::copy_if(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto partition(Args &&... args)
+    -> decltype(::RAJA::partition(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::partition(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto unique(Args &&... args)
+    -> decltype(::RAJA::unique(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return ::RAJA::unique(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto make_list_segment_if(Args &&... args)
+    -> decltype(::RAJA::make_list_segment_if(ExecPolicy{},
+                                             std::forward<Args>(args)...))
+{
+  return ::RAJA::make_list_segment_if(ExecPolicy{},
+                                      std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,305 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Binned accumulator used by RAJA reproducible sum reducers.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_BINNED_SUM_HPP
+#define RAJA_PATTERN_DETAIL_BINNED_SUM_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace RAJA
+{
+
+namespace reduce
+{
+
+namespace detail
+{
+
+/*!
+ * \brief  Bin geometry for floating point types supported by BinnedSum.
+ *
+ *         fold is the number of bins carried by an accumulator and width
+ *         is the number of exponent bits covered by each bin. These are
+ *         the defaults used by ReproBLAS (Demmel, Ahrens, Nguyen).
+ */
+template <typename T>
+struct binned_traits;
+
+template <>
+struct binned_traits<double> {
+  using bits_type = std::uint64_t;
+  static constexpr int fold = 3;
+  static constexpr int width = 40;
+};
+
+template <>
+struct binned_traits<float> {
+  using bits_type = std::uint32_t;
+  static constexpr int fold = 3;
+  static constexpr int width = 13;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Order-independent floating point sum accumulator.
+ *
+ *         The exponent range is split into a fixed grid of bins. Every
+ *         value is split exactly into pieces that are multiples of the
+ *         unit of the bins they fall into, and each piece is added to a
+ *         primary field that only ever holds multiples of that unit, so
+ *         all additions are exact. The state of the accumulator therefore
+ *         depends only on the set of values deposited, not on their order
+ *         or on how partial accumulators are merged, which makes the final
+ *         value bitwise reproducible across execution policies and thread
+ *         counts.
+ *
+ *         Only the fold bins below the largest magnitude seen so far are
+ *         kept, giving roughly fold * width bits of accuracy relative to
+ *         that magnitude.
+ *
+ *         Non-finite values and finite values of magnitude 2^top_exp or
+ *         larger (about 1e304 for double, 8e34 for float) are summed
+ *         conventionally on the side; results involving the latter are
+ *         not reproducible.
+ *
+ *         Reproducibility relies on IEEE round-to-nearest arithmetic; do
+ *         not compile code using this type with value-unsafe floating
+ *         point optimizations such as -ffast-math.
+ *
+ ******************************************************************************
+ */
+template <typename T, bool = std::is_integral<T>::value>
+class BinnedSum
+{
+  static_assert(std::numeric_limits<T>::is_iec559,
+                "BinnedSum requires an IEEE floating point type");
+
+  using traits = binned_traits<T>;
+  using bits_type = typename traits::bits_type;
+
+  static constexpr int fold = traits::fold;
+  static constexpr int width = traits::width;
+  static constexpr int mant_dig = std::numeric_limits<T>::digits;
+
+  //! values deposited in bin i satisfy |x| <= 2^(top_exp - i * width)
+  static constexpr int top_exp =
+      std::numeric_limits<T>::max_exponent - 1 - mant_dig + width;
+
+  //! number of bins whose primary field is a normal number
+  static constexpr int num_bins =
+      (top_exp - (std::numeric_limits<T>::min_exponent - 1 + width - mant_dig))
+          / width
+      + 1;
+
+  //! deposits a primary field absorbs before it must be renormalized
+  static constexpr int endurance = 1 << (mant_dig - width - 2);
+
+  T m_pri[fold];
+  std::int64_t m_car[fold];
+  T m_special;
+  T m_bound;
+  int m_index;
+  int m_count;
+
+  static int bin_exp(int bin) { return top_exp - bin * width; }
+
+  //! primary fields of bin live in [2^k, 2^(k+1)) with this k
+  static int pri_exp(int bin) { return bin_exp(bin) - width + mant_dig; }
+
+  static T pri_base(int bin) { return std::ldexp(T(1.5), pri_exp(bin)); }
+
+  static T pri_quarter(int bin) { return std::ldexp(T(1), pri_exp(bin) - 2); }
+
+  //! set the lowest mantissa bit so rounding into a bin never sees a tie
+  static T with_low_bit(T x)
+  {
+    bits_type bits;
+    std::memcpy(&bits, &x, sizeof(T));
+    bits |= 1;
+    std::memcpy(&x, &bits, sizeof(T));
+    return x;
+  }
+
+  void shift_to(int index)
+  {
+    int d = m_index - index;
+    for (int i = fold - 1; i >= 0; --i) {
+      if (i - d >= 0) {
+        m_pri[i] = m_pri[i - d];
+        m_car[i] = m_car[i - d];
+      } else {
+        m_pri[i] = pri_base(index + i);
+        m_car[i] = 0;
+      }
+    }
+    m_index = index;
+    m_bound = std::ldexp(T(1), bin_exp(index));
+  }
+
+  //! move the top bin up so that x fits; false if x cannot be binned
+  bool raise_index(T x)
+  {
+    if (!std::isfinite(x)) {
+      return false;
+    }
+    int exp;
+    std::frexp(x, &exp);
+    if (exp > top_exp) {
+      return false;
+    }
+    int index = (top_exp - exp) / width;
+    if (index < m_index) {
+      shift_to(index);
+    }
+    return true;
+  }
+
+  //! bring every primary field back into [1.5, 1.75) * 2^k
+  void renormalize()
+  {
+    for (int i = 0; i < fold; ++i) {
+      T quarter = pri_quarter(m_index + i);
+      T q = std::floor((m_pri[i] - pri_base(m_index + i)) / quarter);
+      m_pri[i] -= q * quarter;
+      m_car[i] += static_cast<std::int64_t>(q);
+    }
+    m_count = 0;
+  }
+
+public:
+  BinnedSum()
+      : m_special(0),
+        m_bound(std::ldexp(T(1), bin_exp(num_bins - fold))),
+        m_index(num_bins - fold),
+        m_count(0)
+  {
+    for (int i = 0; i < fold; ++i) {
+      m_pri[i] = pri_base(m_index + i);
+      m_car[i] = 0;
+    }
+  }
+
+  explicit BinnedSum(T val) : BinnedSum() { deposit(val); }
+
+  //! add a single value
+  void deposit(T x)
+  {
+    if (!(std::abs(x) < m_bound) && !raise_index(x)) {
+      m_special += x;
+      return;
+    }
+    if (m_count >= endurance) {
+      renormalize();
+    }
+    T r = x;
+    for (int i = 0; i < fold - 1; ++i) {
+      T m = m_pri[i];
+      T s = m + with_low_bit(r);
+      m_pri[i] = s;
+      r += (m - s);
+    }
+    m_pri[fold - 1] += with_low_bit(r);
+    ++m_count;
+  }
+
+  //! add another accumulator
+  void merge(BinnedSum const& other)
+  {
+    BinnedSum o(other);
+    if (o.m_index < m_index) {
+      shift_to(o.m_index);
+    } else if (m_index < o.m_index) {
+      o.shift_to(m_index);
+    }
+    renormalize();
+    o.renormalize();
+    for (int i = 0; i < fold; ++i) {
+      m_pri[i] += o.m_pri[i] - pri_base(m_index + i);
+      m_car[i] += o.m_car[i];
+    }
+    m_special += o.m_special;
+    renormalize();
+  }
+
+  //! \return the accumulated sum rounded to T
+  T value() const
+  {
+    BinnedSum c(*this);
+    c.renormalize();
+    T res = T(0);
+    for (int i = fold - 1; i >= 0; --i) {
+      res += static_cast<T>(c.m_car[i]) * pri_quarter(m_index + i)
+             + (c.m_pri[i] - pri_base(m_index + i));
+    }
+    return res + m_special;
+  }
+
+  bool operator==(BinnedSum const& rhs) const
+  {
+    if (m_index != rhs.m_index || m_count != rhs.m_count
+        || m_special != rhs.m_special) {
+      return false;
+    }
+    for (int i = 0; i < fold; ++i) {
+      if (m_pri[i] != rhs.m_pri[i] || m_car[i] != rhs.m_car[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool operator!=(BinnedSum const& rhs) const { return !(*this == rhs); }
+};
+
+/*!
+ * \brief  Integer sums are already exact and order-independent.
+ */
+template <typename T>
+class BinnedSum<T, true>
+{
+  T m_sum;
+
+public:
+  BinnedSum() : m_sum(0) {}
+
+  explicit BinnedSum(T val) : m_sum(val) {}
+
+  void deposit(T x) { m_sum += x; }
+
+  void merge(BinnedSum const& other) { m_sum += other.m_sum; }
+
+  T value() const { return m_sum; }
+
+  bool operator==(BinnedSum const& rhs) const { return m_sum == rhs.m_sum; }
+
+  bool operator!=(BinnedSum const& rhs) const { return m_sum != rhs.m_sum; }
+};
+
+}  // namespace detail
+
+}  // namespace reduce
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_BINNED_SUM_HPP */
@@ -0,0 +1,235 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Host stream compaction algorithms shared by the RAJA CPU
+ *         copy_if, partition and unique backends.
+ *
+ *         The algorithms run on the block executors used by the sort
+ *         backends (see RAJA/pattern/detail/sort.hpp). Each one makes a
+ *         counting pass that flags the selected elements of every block,
+ *         scans the per-block counts, and then scatters every block to its
+ *         offset in parallel, so the output keeps the input order.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_COMPACT_HPP
+#define RAJA_PATTERN_DETAIL_COMPACT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+namespace compact
+{
+
+using ::RAJA::detail::sort::block_begin;
+using ::RAJA::detail::sort::num_blocks;
+
+/*!
+ * \brief  Flags the elements of every block with select(i) and returns the
+ *         exclusive scan of the per-block counts, with the total last.
+ */
+template <typename Exec, typename DiffType, typename Select>
+std::vector<DiffType> flag_blocks(Exec const& exec,
+                                  DiffType n,
+                                  int nb,
+                                  unsigned char* flags,
+                                  Select select)
+{
+  std::vector<DiffType> offsets(nb + 1, 0);
+  DiffType* const counts = offsets.data() + 1;
+  exec.run(nb, [=](int b) {
+    const DiffType i1 = block_begin(n, nb, b + 1);
+    DiffType count = 0;
+    for (DiffType i = block_begin(n, nb, b); i < i1; ++i) {
+      const bool keep = select(i);
+      flags[i] = keep;
+      count += keep;
+    }
+    counts[b] = count;
+  });
+  for (int b = 0; b < nb; ++b) {
+    offsets[b + 1] += offsets[b];
+  }
+  return offsets;
+}
+
+/*!
+ * \brief  Copies the elements of [in, in + n) that satisfy pred, keeping
+ *         their order, to the output alloc(count) returns once the number
+ *         of selected elements is known. Returns that number.
+ */
+template <typename Exec,
+          typename Iter,
+          typename DiffType,
+          typename Alloc,
+          typename Pred>
+DiffType copy_if_alloc(Exec const& exec,
+                       Iter in,
+                       DiffType n,
+                       Alloc&& alloc,
+                       Pred pred)
+{
+  const int nb = num_blocks(exec, n);
+  if (nb == 1) {
+    const DiffType count = std::count_if(in, in + n, pred);
+    std::copy_if(in, in + n, alloc(count), pred);
+    return count;
+  }
+
+  std::unique_ptr<unsigned char[]> flag_storage(new unsigned char[n]);
+  unsigned char* const flags = flag_storage.get();
+
+  const std::vector<DiffType> offsets = flag_blocks(
+      exec, n, nb, flags, [=](DiffType i) { return pred(*(in + i)); });
+  const DiffType* const offs = offsets.data();
+
+  const auto out = alloc(offs[nb]);
+  exec.run(nb, [=](int b) {
+    const DiffType i1 = block_begin(n, nb, b + 1);
+    auto dst = out + offs[b];
+    for (DiffType i = block_begin(n, nb, b); i < i1; ++i) {
+      if (flags[i]) {
+        *dst = *(in + i);
+        ++dst;
+      }
+    }
+  });
+  return offs[nb];
+}
+
+/*!
+ * \brief  Copies the elements of [in, in + n) that satisfy pred to out,
+ *         keeping their order. Returns the number of elements copied.
+ */
+template <typename Exec,
+          typename Iter,
+          typename OutIter,
+          typename DiffType,
+          typename Pred>
+DiffType copy_if(Exec const& exec,
+                 Iter in,
+                 DiffType n,
+                 OutIter out,
+                 Pred pred)
+{
+  const int nb = num_blocks(exec, n);
+  if (nb == 1) {
+    return std::copy_if(in, in + n, out, pred) - out;
+  }
+  return copy_if_alloc(exec, in, n, [=](DiffType) { return out; }, pred);
+}
+
+/*!
+ * \brief  Stable partition of [begin, begin + n) so the elements that
+ *         satisfy pred come first. Returns the number of such elements.
+ */
+template <typename Exec, typename Iter, typename DiffType, typename Pred>
+DiffType partition(Exec const& exec, Iter begin, DiffType n, Pred pred)
+{
+  using T = typename std::iterator_traits<Iter>::value_type;
+
+  const int nb = num_blocks(exec, n);
+  if (nb == 1) {
+    return std::stable_partition(begin, begin + n, pred) - begin;
+  }
+
+  std::unique_ptr<unsigned char[]> flag_storage(new unsigned char[n]);
+  unsigned char* const flags = flag_storage.get();
+
+  const std::vector<DiffType> offsets = flag_blocks(
+      exec, n, nb, flags, [=](DiffType i) { return pred(*(begin + i)); });
+  const DiffType* const offs = offsets.data();
+  const DiffType num_true = offs[nb];
+
+  std::unique_ptr<T[]> buffer(new T[n]);
+  T* const buf = buffer.get();
+
+  exec.run(nb, [=](int b) {
+    const DiffType i0 = block_begin(n, nb, b);
+    const DiffType i1 = block_begin(n, nb, b + 1);
+    DiffType t = offs[b];
+    // elements before block b that fail pred come before this block's
+    DiffType f = num_true + (i0 - offs[b]);
+    for (DiffType i = i0; i < i1; ++i) {
+      buf[flags[i] ? t++ : f++] = std::move(*(begin + i));
+    }
+  });
+
+  ::RAJA::detail::sort::parallel_copy(exec, buf, begin, n);
+  return num_true;
+}
+
+/*!
+ * \brief  Removes all but the first element of every run of consecutive
+ *         elements of [begin, begin + n) for which eq holds, keeping their
+ *         order. Returns the number of elements kept.
+ */
+template <typename Exec, typename Iter, typename DiffType, typename Equal>
+DiffType unique(Exec const& exec, Iter begin, DiffType n, Equal eq)
+{
+  using T = typename std::iterator_traits<Iter>::value_type;
+
+  const int nb = num_blocks(exec, n);
+  if (nb == 1) {
+    return std::unique(begin, begin + n, eq) - begin;
+  }
+
+  std::unique_ptr<unsigned char[]> flag_storage(new unsigned char[n]);
+  unsigned char* const flags = flag_storage.get();
+
+  // every element is compared with its neighbor before any is moved
+  const std::vector<DiffType> offsets =
+      flag_blocks(exec, n, nb, flags, [=](DiffType i) {
+        return i == 0 || !eq(*(begin + (i - 1)), *(begin + i));
+      });
+  const DiffType* const offs = offsets.data();
+  const DiffType num_kept = offs[nb];
+
+  std::unique_ptr<T[]> buffer(new T[num_kept]);
+  T* const buf = buffer.get();
+
+  exec.run(nb, [=](int b) {
+    const DiffType i1 = block_begin(n, nb, b + 1);
+    T* dst = buf + offs[b];
+    for (DiffType i = block_begin(n, nb, b); i < i1; ++i) {
+      if (flags[i]) {
+        *dst = std::move(*(begin + i));
+        ++dst;
+      }
+    }
+  });
+
+  ::RAJA::detail::sort::parallel_copy(exec, buf, begin, num_kept);
+  return num_kept;
+}
+
+}  // namespace compact
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_COMPACT_HPP */
@@ -21,6 +21,8 @@
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/pattern/detail/binned_sum.hpp"
+
 #define RAJA_DECLARE_REDUCER(OP, POL, COMBINER)               \
   template <typename T>                                       \
   class Reduce##OP<POL, T>                                    \
@@ -45,9 +47,25 @@
   RAJA_DECLARE_REDUCER(Sum, POL, COMBINER)             \
   RAJA_DECLARE_REDUCER(Min, POL, COMBINER)             \
   RAJA_DECLARE_REDUCER(Max, POL, COMBINER)             \
+  RAJA_DECLARE_REDUCER(ReproSum, POL, COMBINER)        \
   RAJA_DECLARE_INDEX_REDUCER(MinLoc, POL, COMBINER)    \
   RAJA_DECLARE_INDEX_REDUCER(MaxLoc, POL, COMBINER)
 
+#define RAJA_DECLARE_ARRAY_REDUCER(OP, POL, COMBINER)                \
+  template <typename T>                                              \
+  class Reduce##OP##Array<POL, T>                                    \
+      : public reduce::detail::BaseReduce##OP##Array<T, COMBINER>    \
+  {                                                                  \
+  public:                                                            \
+    using Base = reduce::detail::BaseReduce##OP##Array<T, COMBINER>; \
+    using Base::Base;                                                \
+  };
+
+#define RAJA_DECLARE_ALL_ARRAY_REDUCERS(POL, COMBINER)  \
+  RAJA_DECLARE_ARRAY_REDUCER(Sum, POL, COMBINER)        \
+  RAJA_DECLARE_ARRAY_REDUCER(Min, POL, COMBINER)        \
+  RAJA_DECLARE_ARRAY_REDUCER(Max, POL, COMBINER)
+
 namespace RAJA
 {
 
@@ -88,6 +106,26 @@ template <typename T>
 struct max : detail::op_adapter<T, RAJA::operators::maximum> {
 };
 
+/*!
+ * \brief  Combine operator for BinnedSum accumulators; T is the
+ *         accumulator type, not the summed value type.
+ */
+template <typename T>
+struct repro_sum {
+  struct operator_type {
+    T operator()(T const &a, T const &b) const
+    {
+      T res(a);
+      res.merge(b);
+      return res;
+    }
+  };
+
+  static T identity() { return T(); }
+
+  void operator()(T &val, const T v) const { val.merge(v); }
+};
+
 #if defined(RAJA_RAJA_ENABLE_TARGET_OPENMP)
 #pragma omp end declare target
 #endif
@@ -408,6 +446,45 @@ public:
   }
 };
 
+/*!
+ **************************************************************************
+ *
+ * \brief  Reproducible sum reducer class template.
+ *
+ *         Values are accumulated in a BinnedSum, so the result is bitwise
+ *         identical for any execution policy, thread count, or order in
+ *         which partial results are combined.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceReproSum
+    : public BaseReduce<BinnedSum<T>, RAJA::reduce::repro_sum, Combiner>
+{
+public:
+  using Base = BaseReduce<BinnedSum<T>, RAJA::reduce::repro_sum, Combiner>;
+  using value_type = T;
+
+  BaseReduceReproSum() : Base() {}
+
+  BaseReduceReproSum(T init_val) : Base(BinnedSum<T>(init_val)) {}
+
+  void reset(T val) { Base::reset(BinnedSum<T>(val)); }
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceReproSum &operator+=(T rhs) const
+  {
+    this->local().deposit(rhs);
+    return *this;
+  }
+
+  //! Get the calculated reduced value
+  operator T() const { return Base::get().value(); }
+
+  //! Get the calculated reduced value
+  T get() const { return Base::get().value(); }
+};
+
 /*!
  **************************************************************************
  *
@@ -446,6 +523,151 @@ public:
   operator T() const { return Base::get(); }
 };
 
+/*!
+ **************************************************************************
+ *
+ * \brief  Base class template for reducers over an array of bins.
+ *
+ *         The Combiner provides per-thread storage for the bins and
+ *         merges it into the result when the reduced values are read.
+ *
+ **************************************************************************
+ */
+template <typename T,
+          template <typename>
+          class Reduce_,
+          template <typename, typename>
+          class Combiner_>
+class BaseReduceArray
+{
+  using Reduce = Reduce_<T>;
+  using Combiner_t = Combiner_<T, Reduce>;
+  Combiner_t mutable c;
+
+public:
+  using value_type = T;
+  using reduce_type = Reduce;
+
+  BaseReduceArray(Index_type num_bins,
+                  T init_val,
+                  T identity_ = Reduce::identity())
+      : c{num_bins, init_val, identity_}
+  {
+  }
+
+  void reset(T val, T identity_ = Reduce::identity())
+  {
+    c.reset(val, identity_);
+  }
+
+  //! prohibit compiler-generated copy assignment
+  BaseReduceArray &operator=(const BaseReduceArray &) = delete;
+
+  //! compiler-generated copy constructor
+  BaseReduceArray(const BaseReduceArray &copy) : c(copy.c) {}
+
+  //! compiler-generated move constructor
+  BaseReduceArray(BaseReduceArray &&copy) : c(std::move(copy.c)) {}
+
+  void combine(Index_type bin, T const &other) const
+  {
+    Reduce{}(c.local(bin), other);
+  }
+
+  //! Number of bins
+  Index_type size() const { return c.size(); }
+
+  //! Get the calculated reduced value of one bin
+  T get(Index_type bin) const { return c.get(bin); }
+
+  //! Copy the calculated reduced values of all bins into out
+  void get(T *out) const { c.get_all(out); }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Sum reducer class template over an array of bins.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceSumArray : public BaseReduceArray<T, RAJA::reduce::sum, Combiner>
+{
+public:
+  using Base = BaseReduceArray<T, RAJA::reduce::sum, Combiner>;
+  using Base::Base;
+
+  //! reference to one bin, so that hist[bin] += val reads naturally
+  class BinRef
+  {
+    const BaseReduceSumArray &r;
+    Index_type bin;
+
+  public:
+    BinRef(const BaseReduceSumArray &r_, Index_type bin_) : r(r_), bin(bin_) {}
+
+    const BinRef &operator+=(T rhs) const
+    {
+      r.combine(bin, rhs);
+      return *this;
+    }
+  };
+
+  BinRef operator[](Index_type bin) const { return BinRef(*this, bin); }
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceSumArray &add(Index_type bin, T rhs) const
+  {
+    this->combine(bin, rhs);
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Min reducer class template over an array of bins.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceMinArray : public BaseReduceArray<T, RAJA::reduce::min, Combiner>
+{
+public:
+  using Base = BaseReduceArray<T, RAJA::reduce::min, Combiner>;
+  using Base::Base;
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceMinArray &min(Index_type bin, T rhs) const
+  {
+    this->combine(bin, rhs);
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Max reducer class template over an array of bins.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceMaxArray : public BaseReduceArray<T, RAJA::reduce::max, Combiner>
+{
+public:
+  using Base = BaseReduceArray<T, RAJA::reduce::max, Combiner>;
+  using Base::Base;
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceMaxArray &max(Index_type bin, T rhs) const
+  {
+    this->combine(bin, rhs);
+    return *this;
+  }
+};
+
 }  // namespace detail
 
 }  // namespace reduce
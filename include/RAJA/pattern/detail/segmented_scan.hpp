@@ -0,0 +1,211 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Block kernels shared by the RAJA segmented scan and reduce_by_key
+ *         backends.
+ *
+ *         Segments are maximal runs of consecutive equal keys. Each backend
+ *         splits the range into blocks, summarizes every block with
+ *         summarize(), combines the summaries of the blocks before each
+ *         block in order with combine(), and then runs one of the block
+ *         bodies below over each block with that carry.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_SEGMENTED_SCAN_HPP
+#define RAJA_PATTERN_DETAIL_SEGMENTED_SCAN_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+namespace segmented
+{
+
+/*!
+ * \brief  Summary of a block of a segmented range: the number of segments
+ *         that start in it and the reduction of its elements since the
+ *         last segment start (or of all of them if none starts in it).
+ */
+template <typename Value, typename DiffType>
+struct carry {
+  DiffType heads;
+  bool has_head;
+  Value value;
+};
+
+//! carry of an empty prefix
+template <typename Value, typename DiffType, typename BinFn>
+carry<Value, DiffType> empty_carry()
+{
+  return carry<Value, DiffType>{0, false, Value(BinFn::identity())};
+}
+
+//! summary of a prefix followed by a block with summary b
+template <typename Value, typename DiffType, typename BinFn>
+carry<Value, DiffType> combine(carry<Value, DiffType> const& a,
+                               carry<Value, DiffType> const& b,
+                               BinFn f)
+{
+  return carry<Value, DiffType>{a.heads + b.heads,
+                                a.has_head || b.has_head,
+                                b.has_head ? b.value : f(a.value, b.value)};
+}
+
+//! true if a segment starts at index i
+template <typename KeyIter, typename DiffType>
+bool is_head(KeyIter keys, DiffType i)
+{
+  return i == 0 || !(*(keys + i) == *(keys + (i - 1)));
+}
+
+//! summary of the block [i0, i1)
+template <typename Value,
+          typename KeyIter,
+          typename ValIter,
+          typename DiffType,
+          typename BinFn>
+carry<Value, DiffType> summarize(KeyIter keys,
+                                 ValIter vals,
+                                 DiffType i0,
+                                 DiffType i1,
+                                 BinFn f)
+{
+  carry<Value, DiffType> c = empty_carry<Value, DiffType, BinFn>();
+  for (DiffType i = i0; i < i1; ++i) {
+    if (is_head(keys, i)) {
+      ++c.heads;
+      c.has_head = true;
+      c.value = *(vals + i);
+    } else {
+      c.value = f(c.value, *(vals + i));
+    }
+  }
+  return c;
+}
+
+/*!
+ * \brief  Inclusive segmented scan of a block given the carry of the
+ *         blocks before it. out may be the same range as vals.
+ */
+template <typename KeyIter, typename ValIter, typename OutIter, typename BinFn>
+struct inclusive_body {
+  KeyIter keys;
+  ValIter vals;
+  OutIter out;
+  BinFn f;
+
+  template <typename Value, typename DiffType>
+  void operator()(DiffType i0,
+                  DiffType i1,
+                  carry<Value, DiffType> const& c) const
+  {
+    Value running = c.value;
+    for (DiffType i = i0; i < i1; ++i) {
+      const Value x = *(vals + i);
+      running = is_head(keys, i) ? x : f(running, x);
+      *(out + i) = running;
+    }
+  }
+};
+
+/*!
+ * \brief  Exclusive segmented scan of a block given the carry of the
+ *         blocks before it; every segment starts from init. out may be the
+ *         same range as vals.
+ */
+template <typename KeyIter,
+          typename ValIter,
+          typename OutIter,
+          typename BinFn,
+          typename Init>
+struct exclusive_body {
+  KeyIter keys;
+  ValIter vals;
+  OutIter out;
+  BinFn f;
+  Init init;
+
+  template <typename Value, typename DiffType>
+  void operator()(DiffType i0,
+                  DiffType i1,
+                  carry<Value, DiffType> const& c) const
+  {
+    Value running = f(Value(init), c.value);
+    for (DiffType i = i0; i < i1; ++i) {
+      const Value x = *(vals + i);
+      if (is_head(keys, i)) {
+        running = Value(init);
+      }
+      *(out + i) = running;
+      running = f(running, x);
+    }
+  }
+};
+
+/*!
+ * \brief  reduce_by_key over a block given the carry of the blocks before
+ *         it. The key of each segment is written by the block in which the
+ *         segment starts and its value by the block in which it ends.
+ *         Returns the number of segments that start before the block ends.
+ */
+template <typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+struct reduce_by_key_body {
+  KeyIter keys;
+  ValIter vals;
+  KeyOutIter keys_out;
+  ValOutIter vals_out;
+  BinFn f;
+  typename std::iterator_traits<KeyIter>::difference_type n;
+
+  template <typename Value, typename DiffType>
+  DiffType operator()(DiffType i0,
+                      DiffType i1,
+                      carry<Value, DiffType> const& c) const
+  {
+    DiffType seg = c.heads - 1;
+    Value running = c.value;
+    for (DiffType i = i0; i < i1; ++i) {
+      const Value x = *(vals + i);
+      if (is_head(keys, i)) {
+        ++seg;
+        *(keys_out + seg) = *(keys + i);
+        running = x;
+      } else {
+        running = f(running, x);
+      }
+      if (i + 1 == n || is_head(keys, i + 1)) {
+        *(vals_out + seg) = running;
+      }
+    }
+    return seg + 1;
+  }
+};
+
+}  // namespace segmented
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_SEGMENTED_SCAN_HPP */
@@ -0,0 +1,644 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Host sort algorithms shared by the RAJA CPU sort backends.
+ *
+ *         The algorithms here are written against a block executor that
+ *         runs a function over a number of independent blocks, so that the
+ *         same LSD radix sort and merge sort serve the sequential, loop,
+ *         OpenMP and TBB backends. A block executor provides
+ *
+ *           int num_blocks() const;
+ *           template <typename F> void run(int nblocks, F&& f) const;
+ *
+ *         where run calls f(b) for every b in [0, nblocks), possibly
+ *         concurrently, and returns once all calls have completed.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_SORT_HPP
+#define RAJA_PATTERN_DETAIL_SORT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/Operators.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+namespace sort
+{
+
+//! ranges shorter than this are sorted with the standard library
+constexpr std::ptrdiff_t serial_min_size = 1024;
+
+//! minimum number of elements given to one block of a parallel sort
+constexpr std::ptrdiff_t min_block_size = 1 << 14;
+
+//! number of key bits sorted by each radix pass
+constexpr int radix_bits = 8;
+constexpr int radix_size = 1 << radix_bits;
+
+/*!
+ * \brief  Maps keys to unsigned integers whose natural order matches the
+ *         order of the keys. Not defined for types without such a mapping.
+ */
+template <typename T, typename Enable = void>
+struct radix_traits {
+  static constexpr bool value = false;
+};
+
+template <typename T>
+struct radix_traits<
+    T,
+    typename std::enable_if<std::is_integral<T>::value
+                            && !std::is_same<T, bool>::value>::type> {
+  static constexpr bool value = true;
+  using bits_type = typename std::make_unsigned<T>::type;
+
+  static bits_type to_bits(T v)
+  {
+    bits_type b = static_cast<bits_type>(v);
+    if (std::is_signed<T>::value) {
+      b ^= bits_type(1) << (8 * sizeof(T) - 1);
+    }
+    return b;
+  }
+};
+
+template <typename T>
+struct radix_traits<
+    T,
+    typename std::enable_if<std::is_floating_point<T>::value
+                            && std::numeric_limits<T>::is_iec559
+                            && (sizeof(T) == 4 || sizeof(T) == 8)>::type> {
+  static constexpr bool value = true;
+  using bits_type = typename std::
+      conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+
+  static bits_type to_bits(T v)
+  {
+    // -0 and +0 compare equal, so give them the same key to keep stability
+    if (v == T(0)) {
+      v = T(0);
+    }
+    bits_type b;
+    std::memcpy(&b, &v, sizeof(T));
+    const bits_type sign = bits_type(1) << (8 * sizeof(T) - 1);
+    return (b & sign) ? bits_type(~b) : bits_type(b | sign);
+  }
+};
+
+/*!
+ * \brief  Direction in which Compare orders keys of type T when it is a
+ *         plain less or greater comparison: 1 ascending, -1 descending,
+ *         0 for any other comparator.
+ */
+template <typename T, typename Compare>
+struct radix_direction : std::integral_constant<int, 0> {
+};
+
+template <typename T>
+struct radix_direction<T, operators::less<T, T>>
+    : std::integral_constant<int, 1> {
+};
+
+template <typename T>
+struct radix_direction<T, std::less<T>> : std::integral_constant<int, 1> {
+};
+
+template <typename T>
+struct radix_direction<T, operators::greater<T, T>>
+    : std::integral_constant<int, -1> {
+};
+
+template <typename T>
+struct radix_direction<T, std::greater<T>> : std::integral_constant<int, -1> {
+};
+
+//! true if keys of type T ordered by Compare can be radix sorted
+template <typename T, typename Compare>
+using use_radix =
+    std::integral_constant<bool,
+                           radix_traits<T>::value
+                               && radix_direction<T, Compare>::value != 0>;
+
+//! first index of block b when n elements are split into nb blocks
+template <typename DiffType>
+DiffType block_begin(DiffType n, int nb, int b)
+{
+  return static_cast<DiffType>((static_cast<double>(n) * b) / nb);
+}
+
+//! number of blocks to split n elements into
+template <typename Exec, typename DiffType>
+int num_blocks(Exec const& exec, DiffType n)
+{
+  const DiffType by_size = std::max<DiffType>(1, n / min_block_size);
+  return static_cast<int>(
+      std::min<DiffType>(by_size, static_cast<DiffType>(exec.num_blocks())));
+}
+
+/*!
+ * \brief  Moves values alongside keys in a radix or merge pass; the void
+ *         specialization is used when only keys are sorted.
+ */
+template <typename V>
+struct value_buffers {
+  V* src;
+  V* dst;
+
+  void move(std::ptrdiff_t from, std::ptrdiff_t to) const
+  {
+    dst[to] = std::move(src[from]);
+  }
+  void swap() { std::swap(src, dst); }
+};
+
+template <>
+struct value_buffers<void> {
+  void move(std::ptrdiff_t, std::ptrdiff_t) const {}
+  void swap() {}
+};
+
+//! parallel copy of [src, src + n) to dst
+template <typename Exec, typename SrcIter, typename DstIter, typename DiffType>
+void parallel_copy(Exec const& exec, SrcIter src, DstIter dst, DiffType n)
+{
+  const int nb = num_blocks(exec, n);
+  exec.run(nb, [=](int b) {
+    const DiffType i0 = block_begin(n, nb, b);
+    const DiffType i1 = block_begin(n, nb, b + 1);
+    std::move(src + i0, src + i1, dst + i0);
+  });
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Stable LSD radix sort of n keys starting at keys, carrying the
+ *         values in vals (a value_buffers whose src holds the values and
+ *         whose dst is scratch space of the same length).
+ *
+ *         Each pass sorts radix_bits bits. Blocks histogram their part of
+ *         the input, the histograms are scanned digit-major so that each
+ *         block owns a contiguous run of every output bucket, and blocks
+ *         then scatter their keys in input order, which keeps the sort
+ *         stable. Passes in which every key has the same digit are skipped.
+ *
+ ******************************************************************************
+ */
+template <int Direction,
+          typename Exec,
+          typename KeyIter,
+          typename DiffType,
+          typename Vals>
+void radix_sort(Exec const& exec, KeyIter keys, DiffType n, Vals vals)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  using traits = radix_traits<Key>;
+  using bits_type = typename traits::bits_type;
+
+  std::unique_ptr<Key[]> buffer(new Key[n]);
+  Key* buf = buffer.get();
+  bool in_buffer = false;
+
+  const int nb = num_blocks(exec, n);
+  std::vector<DiffType> counts(static_cast<size_t>(nb) * radix_size);
+
+  auto digit = [](Key k, int shift) {
+    bits_type b = traits::to_bits(k);
+    if (Direction < 0) {
+      b = static_cast<bits_type>(~b);
+    }
+    return static_cast<int>((b >> shift) & (radix_size - 1));
+  };
+
+  for (int shift = 0; shift < static_cast<int>(8 * sizeof(bits_type));
+       shift += radix_bits) {
+
+    // keys currently live either in the caller's range or in the buffer
+    auto histogram = [&](auto from) {
+      DiffType* cnt = counts.data();
+      exec.run(nb, [=](int b) {
+        DiffType* c = cnt + static_cast<size_t>(b) * radix_size;
+        std::fill(c, c + radix_size, DiffType(0));
+        const DiffType i1 = block_begin(n, nb, b + 1);
+        for (DiffType i = block_begin(n, nb, b); i < i1; ++i) {
+          ++c[digit(from[i], shift)];
+        }
+      });
+    };
+    if (in_buffer) {
+      histogram(buf);
+    } else {
+      histogram(keys);
+    }
+
+    // skip the pass if every key falls in a single bucket
+    bool trivial = false;
+    for (int d = 0; d < radix_size && !trivial; ++d) {
+      DiffType total = 0;
+      for (int b = 0; b < nb; ++b) {
+        total += counts[static_cast<size_t>(b) * radix_size + d];
+      }
+      trivial = (total == n);
+    }
+    if (trivial) {
+      continue;
+    }
+
+    // exclusive scan in digit-major, block-minor order
+    DiffType offset = 0;
+    for (int d = 0; d < radix_size; ++d) {
+      for (int b = 0; b < nb; ++b) {
+        DiffType& c = counts[static_cast<size_t>(b) * radix_size + d];
+        const DiffType t = c;
+        c = offset;
+        offset += t;
+      }
+    }
+
+    auto scatter = [&](auto from, auto to) {
+      DiffType* cnt = counts.data();
+      exec.run(nb, [=](int b) {
+        DiffType* c = cnt + static_cast<size_t>(b) * radix_size;
+        const DiffType i1 = block_begin(n, nb, b + 1);
+        for (DiffType i = block_begin(n, nb, b); i < i1; ++i) {
+          const DiffType pos = c[digit(from[i], shift)]++;
+          to[pos] = from[i];
+          vals.move(i, pos);
+        }
+      });
+    };
+    if (in_buffer) {
+      scatter(buf, keys);
+    } else {
+      scatter(keys, buf);
+    }
+    in_buffer = !in_buffer;
+    vals.swap();
+  }
+
+  if (in_buffer) {
+    parallel_copy(exec, buf, keys, n);
+    if (!std::is_same<Vals, value_buffers<void>>::value) {
+      // vals.src is the scratch array here and vals.dst the caller's
+      exec.run(nb, [=](int b) {
+        const DiffType i1 = block_begin(n, nb, b + 1);
+        for (DiffType i = block_begin(n, nb, b); i < i1; ++i) {
+          vals.move(i, i);
+        }
+      });
+    }
+  }
+}
+
+/*!
+ * \brief  Number of elements of a[0, m) among the first k elements of the
+ *         stable merge of a[0, m) and b[0, n), where elements of a precede
+ *         equal elements of b.
+ */
+template <typename IterA, typename IterB, typename DiffType, typename Compare>
+DiffType co_rank(DiffType k,
+                 IterA a,
+                 DiffType m,
+                 IterB b,
+                 DiffType n,
+                 Compare comp)
+{
+  DiffType lo = std::max<DiffType>(0, k - n);
+  DiffType hi = std::min<DiffType>(k, m);
+  while (lo < hi) {
+    const DiffType mid = lo + (hi - lo) / 2;
+    if (!comp(b[k - mid - 1], a[mid])) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/*!
+ * \brief  Merge adjacent pairs of sorted runs from src into dst. Each pair
+ *         is split into pieces of equal output length with co_rank so that
+ *         all blocks get the same amount of work. All split points are found
+ *         before any element is moved, since the searches read elements
+ *         that neighbouring pieces move from.
+ */
+template <typename Exec,
+          typename SrcIter,
+          typename DstIter,
+          typename DiffType,
+          typename Compare>
+void merge_round(Exec const& exec,
+                 SrcIter src,
+                 DstIter dst,
+                 std::vector<DiffType> const& bounds,
+                 Compare comp)
+{
+  const int nruns = static_cast<int>(bounds.size()) - 1;
+  const int npairs = (nruns + 1) / 2;
+  const int parts = std::max(1, (exec.num_blocks() + npairs - 1) / npairs);
+  const DiffType* bnd = bounds.data();
+
+  // splits[pair * (parts + 1) + part] elements of the left run precede
+  // the output position where piece part of the pair begins
+  std::vector<DiffType> split_storage(static_cast<size_t>(npairs)
+                                      * (parts + 1));
+  DiffType* splits = split_storage.data();
+
+  auto pair_bounds = [=](int pair, DiffType& lo, DiffType& mid, DiffType& hi) {
+    lo = bnd[2 * pair];
+    mid = bnd[std::min(2 * pair + 1, nruns)];
+    hi = bnd[std::min(2 * pair + 2, nruns)];
+  };
+
+  exec.run(npairs, [=](int pair) {
+    DiffType lo, mid, hi;
+    pair_bounds(pair, lo, mid, hi);
+    for (int part = 0; part <= parts; ++part) {
+      const DiffType k = block_begin(hi - lo, parts, part);
+      splits[pair * (parts + 1) + part] =
+          co_rank(k, src + lo, mid - lo, src + mid, hi - mid, comp);
+    }
+  });
+
+  exec.run(npairs * parts, [=](int t) {
+    const int pair = t / parts;
+    const int part = t % parts;
+    DiffType lo, mid, hi;
+    pair_bounds(pair, lo, mid, hi);
+    const DiffType k0 = block_begin(hi - lo, parts, part);
+    const DiffType k1 = block_begin(hi - lo, parts, part + 1);
+    const DiffType a0 = splits[pair * (parts + 1) + part];
+    const DiffType a1 = splits[pair * (parts + 1) + part + 1];
+    std::merge(std::make_move_iterator(src + lo + a0),
+               std::make_move_iterator(src + lo + a1),
+               std::make_move_iterator(src + mid + (k0 - a0)),
+               std::make_move_iterator(src + mid + (k1 - a1)),
+               dst + lo + k0,
+               comp);
+  });
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Parallel merge sort of [begin, begin + n).
+ *
+ *         Blocks sort their part of the range with the standard library,
+ *         then runs are merged pairwise, alternating between the range and
+ *         a scratch buffer, until one run is left. Merges take equal
+ *         elements from the left run first, so the sort is stable when
+ *         Stable is true.
+ *
+ ******************************************************************************
+ */
+template <bool Stable,
+          typename Exec,
+          typename Iter,
+          typename DiffType,
+          typename Compare>
+void merge_sort(Exec const& exec, Iter begin, DiffType n, Compare comp)
+{
+  using T = typename std::iterator_traits<Iter>::value_type;
+
+  const int nb = num_blocks(exec, n);
+  std::vector<DiffType> bounds(nb + 1);
+  for (int b = 0; b <= nb; ++b) {
+    bounds[b] = block_begin(n, nb, b);
+  }
+
+  const DiffType* bnd = bounds.data();
+  exec.run(nb, [=](int b) {
+    if (Stable) {
+      std::stable_sort(begin + bnd[b], begin + bnd[b + 1], comp);
+    } else {
+      std::sort(begin + bnd[b], begin + bnd[b + 1], comp);
+    }
+  });
+
+  if (nb == 1) {
+    return;
+  }
+
+  std::unique_ptr<T[]> buffer(new T[n]);
+  T* buf = buffer.get();
+  bool in_buffer = false;
+
+  while (bounds.size() > 2) {
+    if (in_buffer) {
+      merge_round(exec, buf, begin, bounds, comp);
+    } else {
+      merge_round(exec, begin, buf, bounds, comp);
+    }
+    in_buffer = !in_buffer;
+
+    std::vector<DiffType> merged;
+    for (size_t r = 0; r < bounds.size(); r += 2) {
+      merged.push_back(bounds[r]);
+    }
+    if (merged.back() != n) {
+      merged.push_back(n);
+    }
+    bounds.swap(merged);
+  }
+
+  if (in_buffer) {
+    parallel_copy(exec, buf, begin, n);
+  }
+}
+
+//! orders key-value pairs by key only
+template <typename Compare>
+struct pair_compare {
+  Compare comp;
+
+  template <typename Pair>
+  bool operator()(Pair const& lhs, Pair const& rhs) const
+  {
+    return comp(lhs.first, rhs.first);
+  }
+};
+
+/*!
+ * \brief  Sort keys and values together with a general comparator by
+ *         merge sorting (key, value) pairs in scratch space.
+ */
+template <bool Stable,
+          typename Exec,
+          typename KeyIter,
+          typename ValIter,
+          typename DiffType,
+          typename Compare>
+void merge_sort_pairs(Exec const& exec,
+                      KeyIter keys,
+                      ValIter vals,
+                      DiffType n,
+                      Compare comp)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  using Val = typename std::iterator_traits<ValIter>::value_type;
+  using Pair = std::pair<Key, Val>;
+
+  std::unique_ptr<Pair[]> pairs(new Pair[n]);
+  Pair* p = pairs.get();
+  const int nb = num_blocks(exec, n);
+
+  exec.run(nb, [=](int b) {
+    const DiffType i1 = block_begin(n, nb, b + 1);
+    for (DiffType i = block_begin(n, nb, b); i < i1; ++i) {
+      p[i].first = std::move(keys[i]);
+      p[i].second = std::move(vals[i]);
+    }
+  });
+
+  merge_sort<Stable>(exec, p, n, pair_compare<Compare>{comp});
+
+  exec.run(nb, [=](int b) {
+    const DiffType i1 = block_begin(n, nb, b + 1);
+    for (DiffType i = block_begin(n, nb, b); i < i1; ++i) {
+      keys[i] = std::move(p[i].first);
+      vals[i] = std::move(p[i].second);
+    }
+  });
+}
+
+// =============================================================================
+//
+// Entry points used by the backends: radix sort for arithmetic keys with
+// less or greater comparators, merge sort otherwise.
+//
+// =============================================================================
+
+template <bool Stable, typename Exec, typename Iter, typename Compare>
+void sort_keys(Exec const& exec,
+               Iter begin,
+               Iter end,
+               Compare comp,
+               std::true_type /* use_radix */)
+{
+  using T = typename std::iterator_traits<Iter>::value_type;
+  const auto n = end - begin;
+  if (n < serial_min_size) {
+    if (Stable) {
+      std::stable_sort(begin, end, comp);
+    } else {
+      std::sort(begin, end, comp);
+    }
+    return;
+  }
+  radix_sort<radix_direction<T, Compare>::value>(exec,
+                                                 begin,
+                                                 n,
+                                                 value_buffers<void>{});
+}
+
+template <bool Stable, typename Exec, typename Iter, typename Compare>
+void sort_keys(Exec const& exec,
+               Iter begin,
+               Iter end,
+               Compare comp,
+               std::false_type /* use_radix */)
+{
+  const auto n = end - begin;
+  if (n < serial_min_size) {
+    if (Stable) {
+      std::stable_sort(begin, end, comp);
+    } else {
+      std::sort(begin, end, comp);
+    }
+    return;
+  }
+  merge_sort<Stable>(exec, begin, n, comp);
+}
+
+template <bool Stable,
+          typename Exec,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+void sort_pairs(Exec const& exec,
+                KeyIter keys_begin,
+                KeyIter keys_end,
+                ValIter vals_begin,
+                Compare,
+                std::true_type /* use_radix */)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  using Val = typename std::iterator_traits<ValIter>::value_type;
+  const auto n = keys_end - keys_begin;
+
+  // radix sort moves values through raw arrays
+  std::unique_ptr<Val[]> vals(new Val[n]);
+  std::unique_ptr<Val[]> scratch(new Val[n]);
+  parallel_copy(exec, vals_begin, vals.get(), n);
+
+  radix_sort<radix_direction<Key, Compare>::value>(
+      exec, keys_begin, n, value_buffers<Val>{vals.get(), scratch.get()});
+
+  parallel_copy(exec, vals.get(), vals_begin, n);
+}
+
+template <bool Stable,
+          typename Exec,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+void sort_pairs(Exec const& exec,
+                KeyIter keys_begin,
+                KeyIter keys_end,
+                ValIter vals_begin,
+                Compare comp,
+                std::false_type /* use_radix */)
+{
+  merge_sort_pairs<Stable>(
+      exec, keys_begin, vals_begin, keys_end - keys_begin, comp);
+}
+
+//! block executor that runs every block on the calling thread
+struct serial_blocks {
+  int num_blocks() const { return 1; }
+
+  template <typename F>
+  void run(int nblocks, F&& f) const
+  {
+    for (int b = 0; b < nblocks; ++b) {
+      f(b);
+    }
+  }
+};
+
+}  // namespace sort
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_SORT_HPP */
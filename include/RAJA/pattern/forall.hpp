@@ -132,6 +132,18 @@ struct icount_adapter {
 struct CallForall {
   template <typename T, typename ExecPol, typename Body>
   RAJA_INLINE void operator()(T const&, ExecPol, Body) const;
+
+  // bitmask segments loop over their words
+  template <typename T, typename ExecPol, typename Body>
+  RAJA_INLINE void operator()(TypedBitmaskSegment<T> const&,
+                              ExecPol,
+                              Body) const;
+
+  // run list segments loop over their runs
+  template <typename T, typename ExecPol, typename Body>
+  RAJA_INLINE void operator()(TypedRunListSegment<T> const&,
+                              ExecPol,
+                              Body) const;
 };
 
 struct CallForallIcount {
@@ -165,6 +177,8 @@ namespace wrap
 template <typename ExecutionPolicy, typename Container, typename LoopBody>
 RAJA_INLINE concepts::enable_if<
     concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_bitmask_segment<Container>>,
+    concepts::negate<type_traits::is_run_list_segment<Container>>,
     type_traits::is_range<Container>>
 forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
 {
@@ -177,6 +191,54 @@ forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
               body);
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a bitmask segment, looping over its words with the
+ *        given policy
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if<
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    type_traits::is_bitmask_segment<Container>>
+forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
+{
+
+  using RAJA::internal::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  using policy::sequential::forall_impl;
+  forall_impl(std::forward<ExecutionPolicy>(p),
+              RangeSegment(0, c.getNumWords()),
+              detail::make_bitmask_word_body(c, body));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a run list segment, looping over its runs with the
+ *        given policy
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if<
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    type_traits::is_run_list_segment<Container>>
+forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
+{
+
+  using RAJA::internal::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  using policy::sequential::forall_impl;
+  forall_impl(std::forward<ExecutionPolicy>(p),
+              RangeSegment(0, c.getNumRuns()),
+              detail::make_run_list_body(c, body));
+}
+
 /*!
  ******************************************************************************
  *
@@ -188,10 +250,13 @@ template <typename ExecutionPolicy,
           typename Container,
           typename IndexType,
           typename LoopBody>
-RAJA_INLINE void forall_Icount(ExecutionPolicy&& p,
-                               Container&& c,
-                               IndexType&& icount,
-                               LoopBody&& loop_body)
+RAJA_INLINE concepts::enable_if<
+    concepts::negate<type_traits::is_bitmask_segment<Container>>,
+    concepts::negate<type_traits::is_run_list_segment<Container>>>
+forall_Icount(ExecutionPolicy&& p,
+              Container&& c,
+              IndexType&& icount,
+              LoopBody&& loop_body)
 {
   using RAJA::internal::trigger_updates_before;
   auto body = trigger_updates_before(loop_body);
@@ -207,6 +272,62 @@ RAJA_INLINE void forall_Icount(ExecutionPolicy&& p,
   forall_impl(std::forward<ExecutionPolicy>(p), range, adapted);
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a bitmask segment with icount, looping over its words
+ *        with the given policy
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Container,
+          typename IndexType,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if<type_traits::is_bitmask_segment<Container>>
+forall_Icount(ExecutionPolicy&& p,
+              Container&& c,
+              IndexType&& icount,
+              LoopBody&& loop_body)
+{
+  using RAJA::internal::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  using policy::sequential::forall_impl;
+  forall_impl(std::forward<ExecutionPolicy>(p),
+              RangeSegment(0, c.getNumWords()),
+              detail::make_bitmask_word_icount_body<
+                  typename std::decay<IndexType>::type>(c, icount, body));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a run list segment with icount, looping over its runs
+ *        with the given policy
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Container,
+          typename IndexType,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if<type_traits::is_run_list_segment<Container>>
+forall_Icount(ExecutionPolicy&& p,
+              Container&& c,
+              IndexType&& icount,
+              LoopBody&& loop_body)
+{
+  using RAJA::internal::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  using policy::sequential::forall_impl;
+  forall_impl(std::forward<ExecutionPolicy>(p),
+              RangeSegment(0, c.getNumRuns()),
+              detail::make_run_list_icount_body<
+                  typename std::decay<IndexType>::type>(c, icount, body));
+}
+
 /*!
 ******************************************************************************
 *
@@ -496,6 +617,28 @@ RAJA_INLINE void CallForall::operator()(T const& segment,
   forall_impl(ExecutionPolicy(), segment, body);
 }
 
+template <typename T, typename ExecutionPolicy, typename LoopBody>
+RAJA_INLINE void CallForall::operator()(TypedBitmaskSegment<T> const& segment,
+                                        ExecutionPolicy,
+                                        LoopBody body) const
+{
+  using policy::sequential::forall_impl;
+  forall_impl(ExecutionPolicy(),
+              RangeSegment(0, segment.getNumWords()),
+              make_bitmask_word_body(segment, body));
+}
+
+template <typename T, typename ExecutionPolicy, typename LoopBody>
+RAJA_INLINE void CallForall::operator()(TypedRunListSegment<T> const& segment,
+                                        ExecutionPolicy,
+                                        LoopBody body) const
+{
+  using policy::sequential::forall_impl;
+  forall_impl(ExecutionPolicy(),
+              RangeSegment(0, segment.getNumRuns()),
+              make_run_list_body(segment, body));
+}
+
 constexpr CallForallIcount::CallForallIcount(int s) : start(s) {}
 
 template <typename T, typename ExecutionPolicy, typename LoopBody>
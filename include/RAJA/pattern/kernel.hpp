@@ -165,6 +165,7 @@ RAJA_INLINE void kernel(SegmentTuple &&segments, Bodies &&... bodies)
 #include "RAJA/pattern/kernel/Region.hpp"
 #include "RAJA/pattern/kernel/Tile.hpp"
 #include "RAJA/pattern/kernel/TileTCount.hpp"
+#include "RAJA/pattern/kernel/ViewCursor.hpp"
 
 
 #endif /* RAJA_pattern_kernel_HPP */
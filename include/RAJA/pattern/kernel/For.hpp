@@ -35,6 +35,7 @@ namespace statement
 /*!
  * A RAJA::kernel statement that implements a single loop.
  * Assigns the loop iterate to argument ArgumentId
+ * Moves the RAJA::ViewCursor params bound to argument ArgumentId
  *
  */
 template <camp::idx_t ArgumentId,
@@ -70,6 +71,7 @@ struct ForWrapper : public GenericWrapper<Data, Types, EnclosedStmts...> {
   RAJA_INLINE void operator()(InIndexType i)
   {
     Base::data.template assign_offset<ArgumentId>(i);
+    Base::data.template advance_view_cursors<ArgumentId>(i);
     Base::exec();
   }
 };
@@ -37,6 +37,7 @@ namespace statement
  * A RAJA::kernel statement that implements a single loop.
  * Assigns the loop iterate to argument ArgumentId
  * Assigns the loop index to param ParamId
+ * Moves the RAJA::ViewCursor params bound to argument ArgumentId
  *
  */
 template <camp::idx_t ArgumentId,
@@ -76,6 +77,7 @@ struct ForICountWrapper : public GenericWrapper<Data, Types, EnclosedStmts...> {
   RAJA_INLINE void operator()(InIndexType i)
   {
     Base::data.template assign_offset<ArgumentId>(i);
+    Base::data.template advance_view_cursors<ArgumentId>(i);
     Base::data.template assign_param<ParamId>(i);
     Base::exec();
   }
@@ -27,6 +27,9 @@
 #include "camp/concepts.hpp"
 #include "camp/tuple.hpp"
 
+#include "RAJA/index/IndexValue.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
 #include "RAJA/pattern/kernel/internal.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
@@ -58,6 +61,20 @@ struct tile_fixed {
   static constexpr camp::idx_t chunk_size = chunk_size_;
 };
 
+///! tag for a tiling loop whose tiles start at index values that are
+///! multiples of chunk_size_, so the first tile may be partial; the tiled
+///! segment must be a TypedRangeSegment
+template <camp::idx_t chunk_size_>
+struct tile_aligned {
+  static constexpr camp::idx_t chunk_size = chunk_size_;
+};
+
+///! tag for a tiling loop over the tiles of dimension Dim of a TiledLayout,
+///! which visits the elements of one tile of the layout per tile
+template <typename TiledLayoutType, camp::idx_t Dim>
+using tile_layout = tile_aligned<
+    TiledLayoutType::template tile_size<Dim>::value>;
+
 
 
 namespace internal
@@ -87,6 +104,49 @@ struct TileWrapper : public GenericWrapper<Data, Types, EnclosedStmts...> {
 };
 
 
+/*!
+ * Number of indices that a tiling policy leaves out of the first tile of a
+ * segment, zero unless the tiles are aligned to the index values.
+ */
+template <typename TilePolicy>
+struct TileSkew {
+  template <typename Segment>
+  static RAJA_INLINE camp::idx_t get(Segment const &)
+  {
+    return 0;
+  }
+};
+
+/*!
+ * Segments whose index values step by one with position, the only ones
+ * whose tiles can be aligned to index values by skewing positions.
+ */
+template <typename Segment>
+struct is_unit_stride_segment : std::false_type {
+};
+
+template <typename StorageT, typename DiffT>
+struct is_unit_stride_segment<TypedRangeSegment<StorageT, DiffT>>
+    : std::true_type {
+};
+
+template <camp::idx_t chunk_size>
+struct TileSkew<tile_aligned<chunk_size>> {
+  template <typename Segment>
+  static RAJA_INLINE camp::idx_t get(Segment const &segment)
+  {
+    static_assert(is_unit_stride_segment<camp::decay<Segment>>::value,
+                  "tile_aligned and tile_layout need a TypedRangeSegment, "
+                  "tiles of other segments are sliced by position");
+    if (segment.end() - segment.begin() <= 0) {
+      return 0;
+    }
+    const camp::idx_t first = stripIndexType(*segment.begin());
+    return (first % chunk_size + chunk_size) % chunk_size;
+  }
+};
+
+
 template <typename Iterable>
 struct IterableTiler {
   using value_type = camp::decay<Iterable>;
@@ -121,8 +181,14 @@ struct IterableTiler {
     RAJA_INLINE
     value_type operator*()
     {
-      auto start = block_id * itiler.block_size;
-      return iterate{itiler.it.slice(start, itiler.block_size), block_id};
+      auto start = block_id * itiler.block_size - itiler.skew;
+      auto length = itiler.block_size;
+      if (start < 0) {
+        // the first tile is shortened by the skew
+        length += start;
+        start = 0;
+      }
+      return iterate{itiler.it.slice(start, length), block_id};
     }
 
     RAJA_HOST_DEVICE
@@ -167,16 +233,18 @@ struct IterableTiler {
 
   RAJA_HOST_DEVICE
   RAJA_INLINE
-  IterableTiler(const Iterable &it_, camp::idx_t block_size_)
-      : it{it_}, block_size{block_size_}
+  IterableTiler(const Iterable &it_,
+                camp::idx_t block_size_,
+                camp::idx_t skew_ = 0)
+      : it{it_}, block_size{block_size_}, skew{skew_}
   {
     using std::begin;
     using std::distance;
     using std::end;
     dist = it.end() - it.begin();  // distance(begin(it), end(it));
-    num_blocks = dist / block_size;
-    // if (dist % block_size) num_blocks += 1;
-    if (dist - num_blocks * block_size > 0) {
+    num_blocks = (dist + skew) / block_size;
+    // if ((dist + skew) % block_size) num_blocks += 1;
+    if (dist + skew - num_blocks * block_size > 0) {
       num_blocks += 1;
     }
   }
@@ -191,6 +259,7 @@ struct IterableTiler {
 
   value_type it;
   camp::idx_t block_size;
+  camp::idx_t skew;
   camp::idx_t num_blocks;
   camp::idx_t dist;
 };
@@ -220,7 +289,8 @@ struct StatementExecutor<
 
     // Create a tile iterator, needs to survive until the forall is
     // done executing.
-    IterableTiler<decltype(segment)> tiled_iterable(segment, chunk_size);
+    IterableTiler<decltype(segment)> tiled_iterable(
+        segment, chunk_size, TileSkew<TPol>::get(segment));
 
     // Wrap in case forall_impl needs to thread_privatize
     TileWrapper<ArgumentId, Data, Types,
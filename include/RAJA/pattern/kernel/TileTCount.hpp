@@ -116,7 +116,8 @@ struct StatementExecutor<
 
     // Create a tile iterator, needs to survive until the forall is
     // done executing.
-    IterableTiler<decltype(segment)> tiled_iterable(segment, chunk_size);
+    IterableTiler<decltype(segment)> tiled_iterable(
+        segment, chunk_size, TileSkew<TPol>::get(segment));
 
     // Wrap in case forall_impl needs to thread_privatize
     TileTCountWrapper<ArgumentId, ParamId, Data, Types,
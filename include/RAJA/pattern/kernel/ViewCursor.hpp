@@ -0,0 +1,273 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for ViewCursor, a kernel parameter that follows the
+ *          loop indices through a View.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_ViewCursor_HPP
+#define RAJA_pattern_kernel_ViewCursor_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/View.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Strides and origin of the layouts a ViewCursor can follow, which are the
+ * layouts whose linear index is a sum of index times stride plus a constant.
+ * Derived layouts (TypedLayout, OffsetLayout, TypedOffsetLayout) are mapped
+ * to these by view_cursor_layout_t.
+ */
+template <typename Layout>
+struct ViewCursorLayout;
+
+template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
+struct ViewCursorLayout<
+    LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim>> {
+  using Layout =
+      LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim>;
+  using IndexLinear = IdxLin;
+
+  static constexpr ptrdiff_t stride_one_dim = StrideOneDim;
+
+  RAJA_INLINE RAJA_HOST_DEVICE static IdxLin stride(Layout const &layout,
+                                                     camp::idx_t dim)
+  {
+    return layout.strides[dim];
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE static IdxLin origin(Layout const &)
+  {
+    return IdxLin(0);
+  }
+};
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+struct ViewCursorLayout<
+    internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin>> {
+  using Layout =
+      internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin>;
+  using IndexLinear = IdxLin;
+
+  static constexpr ptrdiff_t stride_one_dim = -1;
+
+  RAJA_INLINE RAJA_HOST_DEVICE static IdxLin stride(Layout const &layout,
+                                                     camp::idx_t dim)
+  {
+    return layout.base_.strides[dim];
+  }
+
+  //! linear index of the zero index, outside the layout when offsets > 0
+  RAJA_INLINE RAJA_HOST_DEVICE static IdxLin origin(Layout const &layout)
+  {
+    return -sum<IdxLin>(
+        (layout.offsets[RangeInts] * layout.base_.strides[RangeInts])...);
+  }
+};
+
+template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
+LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim>
+view_cursor_layout(
+    LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim> const
+        *);
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin>
+view_cursor_layout(
+    internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> const *);
+
+//! the ViewCursorLayout of Layout or of the layout it derives from
+template <typename Layout>
+using view_cursor_layout_t = ViewCursorLayout<decltype(
+    view_cursor_layout(static_cast<Layout const *>(nullptr)))>;
+
+/*!
+ * The View underneath a View or TypedView.
+ */
+template <typename ViewType>
+struct ViewCursorView {
+  using type = ViewType;
+
+  RAJA_INLINE static type const &get(ViewType const &view) { return view; }
+};
+
+template <typename ValueType,
+          typename PointerType,
+          typename LayoutType,
+          typename... IndexTypes>
+struct ViewCursorView<
+    TypedViewBase<ValueType, PointerType, LayoutType, IndexTypes...>> {
+  using type = View<ValueType, LayoutType, PointerType>;
+
+  RAJA_INLINE static type const &get(
+      TypedViewBase<ValueType, PointerType, LayoutType, IndexTypes...> const
+          &view)
+  {
+    return view.base_;
+  }
+};
+
+template <typename ViewType, typename Dims, typename ArgIds>
+class ViewCursor_impl;
+
+template <typename ViewType, camp::idx_t... Dims, camp::idx_t... ArgIds>
+class ViewCursor_impl<ViewType,
+                      camp::idx_seq<Dims...>,
+                      camp::idx_seq<ArgIds...>>
+    : public internal::ViewCursorBase
+{
+  using view_type = typename ViewCursorView<ViewType>::type;
+  using layout_traits =
+      view_cursor_layout_t<typename view_type::layout_type>;
+  using IdxLin = typename layout_traits::IndexLinear;
+
+public:
+  using value_type = typename view_type::value_type;
+  using pointer_type = typename view_type::pointer_type;
+
+  static constexpr size_t n_dims = sizeof...(Dims);
+
+  static_assert(n_dims == view_type::layout_type::n_dims,
+                "ViewCursor needs one kernel argument per View dimension");
+
+  /*!
+   * Construct a cursor at the zero index of view.
+   */
+  RAJA_INLINE ViewCursor_impl(ViewType const &view)
+      : m_data{ViewCursorView<ViewType>::get(view).data},
+        m_origin{layout_traits::origin(
+            ViewCursorView<ViewType>::get(view).layout)},
+        m_strides{layout_traits::stride(
+            ViewCursorView<ViewType>::get(view).layout,
+            Dims)...},
+        m_terms{}
+  {
+  }
+
+  /*!
+   * Moves the cursor to index value of every dimension bound to kernel
+   * argument ArgumentId, leaving the other dimensions where they are.
+   */
+  template <camp::idx_t ArgumentId, typename Value>
+  RAJA_HOST_DEVICE RAJA_INLINE void advance(Value const &value)
+  {
+    camp::sink(assign<Dims>(
+        IdxLin(stripIndexType(value)),
+        std::integral_constant<bool, ArgIds == ArgumentId>{})...);
+  }
+
+  //! the element of the View at the cursor
+  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()() const
+  {
+    return m_data[offset()];
+  }
+
+  /*!
+   * Linear index of the cursor in the View's layout.
+   * The terms of the outer loops are invariant in the inner loops, so their
+   * sum is hoisted and the innermost loop only adds its own term.
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE IdxLin offset() const
+  {
+    return m_origin + sum<IdxLin>(m_terms[Dims]...);
+  }
+
+private:
+  template <camp::idx_t Dim>
+  RAJA_HOST_DEVICE RAJA_INLINE int assign(IdxLin, std::false_type)
+  {
+    return 0;
+  }
+
+  // one multiply per loop iterate, and none for the stride one dimension
+  template <camp::idx_t Dim>
+  RAJA_HOST_DEVICE RAJA_INLINE int assign(IdxLin index, std::true_type)
+  {
+    m_terms[Dim] =
+        ConditionalMultiply<Dim, layout_traits::stride_one_dim>::multiply(
+            index, m_strides[Dim]);
+    return 0;
+  }
+
+  pointer_type m_data;
+  IdxLin m_origin;
+  IdxLin m_strides[n_dims];
+  IdxLin m_terms[n_dims];
+};
+
+template <typename ViewType, camp::idx_t... Dims, camp::idx_t... ArgIds>
+constexpr size_t ViewCursor_impl<ViewType,
+                                 camp::idx_seq<Dims...>,
+                                 camp::idx_seq<ArgIds...>>::n_dims;
+
+}  // namespace detail
+
+/*!
+ * @brief A RAJA::kernel parameter that keeps the linear offset of a View
+ * element in step with the loops of the kernel.
+ *
+ * Dimension d of the View follows kernel argument ArgIds[d]. Each iterate of
+ * a statement::For or statement::ForICount over argument a replaces the
+ * terms of the dimensions bound to a, so the lambda reads the element with
+ * cursor() instead of recomputing the dot product of every index with the
+ * strides. The products of the outer loops are formed once per outer
+ * iterate, as with hand hoisted raw pointer code.
+ *
+ * For example, with loops over (m, d, g, z) as kernel arguments 0 to 3:
+ *
+ *     using PhiCursor = ViewCursor<PhiView, 0, 2, 3>;   // phi(m, g, z)
+ *     using PsiCursor = ViewCursor<PsiView, 1, 2, 3>;   // psi(d, g, z)
+ *     using LCursor = ViewCursor<LView, 0, 1>;          // L(m, d)
+ *
+ *     // Pol invokes statement::Lambda<0, Params<0, 1, 2>>
+ *     kernel_param<Pol>(
+ *         segments,
+ *         make_tuple(PhiCursor(phi), LCursor(L), PsiCursor(psi)),
+ *         [=](PhiCursor &phi_c, LCursor &L_c, PsiCursor &psi_c) {
+ *           phi_c() += L_c() * psi_c();
+ *         });
+ *
+ * Views with Layout, TypedLayout, OffsetLayout and TypedOffsetLayout, and
+ * the TypedView forms of them, are supported. Cursors start at the zero
+ * index and only move in statement::For and statement::ForICount; other
+ * loop statements (Collapse, Hyperplane, and the GPU and OpenMP target
+ * statements) do not move them. Lambdas should take cursors by reference.
+ */
+template <typename ViewType, camp::idx_t... ArgIds>
+using ViewCursor =
+    detail::ViewCursor_impl<ViewType,
+                            camp::make_idx_seq_t<sizeof...(ArgIds)>,
+                            camp::idx_seq<ArgIds...>>;
+
+}  // namespace RAJA
+
+#endif /* RAJA_pattern_kernel_ViewCursor_HPP */
@@ -48,6 +48,10 @@ namespace internal
   };
   struct CollapseBase {
   };
+  // Universal base of kernel params that follow the loop indices,
+  // see RAJA::ViewCursor
+  struct ViewCursorBase {
+  };
   template <camp::idx_t ArgumentId, typename Policy>
   struct ForTraitBase : public ForBase {
     constexpr static camp::idx_t index_val = ArgumentId;
@@ -96,6 +100,36 @@ using index_tuple_from_segments =
 
 
 
+/*!
+ * Updates a ViewCursor parameter with the value of segment at offset i,
+ * other parameters are left alone.
+ */
+template <camp::idx_t ArgumentId,
+          typename Param,
+          typename Segment,
+          typename IndexT>
+RAJA_HOST_DEVICE RAJA_INLINE
+    typename std::enable_if<!std::is_base_of<ViewCursorBase, Param>::value,
+                            int>::type
+    advance_view_cursor(Param &, Segment const &, IndexT const &)
+{
+  return 0;
+}
+
+template <camp::idx_t ArgumentId,
+          typename Param,
+          typename Segment,
+          typename IndexT>
+RAJA_HOST_DEVICE RAJA_INLINE
+    typename std::enable_if<std::is_base_of<ViewCursorBase, Param>::value,
+                            int>::type
+    advance_view_cursor(Param &cursor, Segment const &segment, IndexT const &i)
+{
+  cursor.template advance<ArgumentId>(segment.begin()[i]);
+  return 0;
+}
+
+
 template <typename SegmentTuple,
           typename ParamTuple,
           typename... Bodies>
@@ -144,6 +178,26 @@ struct LoopData {
     camp::get<Idx>(offset_tuple) = i;
   }
 
+  /*!
+   * Moves the ViewCursor params to offset i of segment Idx.
+   */
+  template <camp::idx_t Idx, typename IndexT>
+  RAJA_HOST_DEVICE RAJA_INLINE void advance_view_cursors(IndexT const &i)
+  {
+    advance_view_cursors_expanded<Idx>(
+        i, camp::make_idx_seq_t<camp::tuple_size<param_tuple_t>::value>{});
+  }
+
+  template <camp::idx_t Idx, typename IndexT, camp::idx_t... ParamIdx>
+  RAJA_HOST_DEVICE RAJA_INLINE void advance_view_cursors_expanded(
+      IndexT const &i,
+      camp::idx_seq<ParamIdx...> const &)
+  {
+    camp::sink(advance_view_cursor<Idx>(camp::get<ParamIdx>(param_tuple),
+                                        camp::get<Idx>(segment_tuple),
+                                        i)...);
+  }
+
   template <typename ParamId, typename IndexT>
   RAJA_HOST_DEVICE RAJA_INLINE void assign_param(IndexT const &i)
   {
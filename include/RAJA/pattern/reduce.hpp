@@ -180,6 +180,110 @@ class ReduceMaxLoc;
  */
 template <typename REDUCE_POLICY_T, typename T>
 class ReduceSum;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reproducible sum reducer class template.
+ *
+ * Same usage as ReduceSum, but the result is bitwise identical for every
+ * CPU reduction policy and any number of threads. Available for seq_reduce,
+ * omp_reduce, omp_reduce_ordered and tbb_reduce.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   ReduceReproSum<reduce_policy, Real_type> my_sum(init_val);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_sum += data[i];
+   }
+
+   Real_type sum = my_sum.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceReproSum;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Sum reducer class template over an array of bins.
+ *
+ * Each thread accumulates into a private copy of the bins, and the copies
+ * are merged in parallel blocks when the result is read. Available for
+ * seq_reduce, omp_reduce, omp_reduce_ordered and tbb_reduce.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   Index_ptr bin_of = ...;
+   ReduceSumArray<reduce_policy, Real_type> hist(num_bins, 0.0);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      hist[bin_of[i]] += data[i];
+   }
+
+   Real_type bin0 = hist.get(0);
+   hist.get(all_bins_ptr);
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceSumArray;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Min reducer class template over an array of bins.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   ReduceMinArray<reduce_policy, Real_type> mins(num_bins, init_val);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      mins.min(bin_of[i], data[i]);
+   }
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceMinArray;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Max reducer class template over an array of bins.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   ReduceMaxArray<reduce_policy, Real_type> maxs(num_bins, init_val);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      maxs.max(bin_of[i], data[i]);
+   }
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceMaxArray;
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
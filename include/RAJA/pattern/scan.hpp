@@ -362,6 +362,180 @@ exclusive_scan(const ExecPolicy &p,
   impl::scan::exclusive(p, std::begin(c), std::end(c), out, binop, value);
 }
 
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive segmented scan execution pattern
+*
+*         Each maximal run of consecutive equal keys is scanned on its own.
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[in] vals_begin Pointer or Random-Access Iterator to start of values
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+*
+* \note{out may be the same range as the values but must not overlap the
+*keys}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename IterOut,
+          typename Function = operators::plus<detail::IterVal<ValIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<ValIter>,
+                    type_traits::is_iterator<IterOut>>
+inclusive_segmented_scan(const ExecPolicy &p,
+                         KeyIter keys_begin,
+                         KeyIter keys_end,
+                         ValIter vals_begin,
+                         IterOut out,
+                         Function binop = Function{})
+{
+  using R = detail::IterVal<ValIter>;
+  static_assert(type_traits::is_binary_function<Function, R, R, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Values Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return;
+  }
+  impl::scan::inclusive_segmented(
+      p, keys_begin, keys_end, vals_begin, out, binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive segmented scan execution pattern
+*
+*         Each maximal run of consecutive equal keys is scanned on its own,
+*         starting from value.
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[in] vals_begin Pointer or Random-Access Iterator to start of values
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of each segment
+*
+* \note{out may be the same range as the values but must not overlap the
+*keys}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename IterOut,
+          typename T = detail::IterVal<ValIter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<ValIter>,
+                    type_traits::is_iterator<IterOut>>
+exclusive_segmented_scan(const ExecPolicy &p,
+                         KeyIter keys_begin,
+                         KeyIter keys_end,
+                         ValIter vals_begin,
+                         IterOut out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using R = detail::IterVal<IterOut>;
+  using U = detail::IterVal<ValIter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Values Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return;
+  }
+  impl::scan::exclusive_segmented(
+      p, keys_begin, keys_end, vals_begin, out, binop, value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  reduce by key execution pattern
+*
+*         Reduces each maximal run of consecutive equal keys to one key and
+*         one value.
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[in] vals_begin Pointer or Random-Access Iterator to start of values
+* \param[out] keys_out Pointer or Random-Access Iterator to start of the key
+*of each segment
+* \param[out] vals_out Pointer or Random-Access Iterator to start of the
+*reduced value of each segment
+* \param[in] binop binary function to apply for reduction
+*
+* \return the number of segments written to keys_out and vals_out
+*
+* \note{The output ranges must not overlap the input ranges}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename Function = operators::plus<detail::IterVal<ValIter>>>
+typename std::enable_if<
+    type_traits::is_execution_policy<ExecPolicy>::value
+        && type_traits::is_iterator<KeyIter>::value
+        && type_traits::is_iterator<ValIter>::value
+        && type_traits::is_iterator<KeyOutIter>::value
+        && type_traits::is_iterator<ValOutIter>::value,
+    typename std::iterator_traits<KeyIter>::difference_type>::type
+reduce_by_key(const ExecPolicy &p,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              ValIter vals_begin,
+              KeyOutIter keys_out,
+              ValOutIter vals_out,
+              Function binop = Function{})
+{
+  using R = detail::IterVal<ValIter>;
+  static_assert(type_traits::is_binary_function<Function, R, R, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Values Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<KeyOutIter>::value,
+                "Keys Output Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValOutIter>::value,
+                "Values Output Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return 0;
+  }
+  return impl::scan::reduce_by_key(
+      p, keys_begin, keys_end, vals_begin, keys_out, vals_out, binop);
+}
+
 template <typename ExecPolicy, typename... Args>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
 exclusive_scan(Args &&... args)
@@ -390,6 +564,27 @@ inclusive_scan_inplace(Args &&... args)
   inclusive_scan_inplace(ExecPolicy{}, std::forward<Args>(args)...);
 }
 
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive_segmented_scan(Args &&... args)
+{
+  inclusive_segmented_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive_segmented_scan(Args &&... args)
+{
+  exclusive_segmented_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto reduce_by_key(Args &&... args)
+    -> decltype(reduce_by_key(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return reduce_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
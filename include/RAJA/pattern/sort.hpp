@@ -0,0 +1,345 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_HPP
+#define RAJA_sort_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/Operators.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Iter>
+using SortIterVal = camp::decay<decltype(*camp::val<Iter>())>;
+
+template <typename Container>
+using SortContainerVal =
+    camp::decay<decltype(*camp::val<camp::iterator_from<Container>>())>;
+
+}  // end namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  sort execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] comp comparison function to apply for sort
+*
+* \note{Arithmetic keys compared with less or greater are radix sorted;
+*other comparators use a merge sort.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<detail::SortIterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+sort(const ExecPolicy &p, Iter begin, Iter end, Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::sort::unstable(p, begin, end, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] comp comparison function to apply for sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<detail::SortIterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+stable_sort(const ExecPolicy &p,
+            Iter begin,
+            Iter end,
+            Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::sort::stable(p, begin, end, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sort pairs execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[in,out] vals_begin Pointer or Random-Access Iterator to start of
+*values, reordered along with the keys
+* \param[in] comp comparison function to apply to keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare = operators::less<detail::SortIterVal<KeyIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<ValIter>>
+sort_pairs(const ExecPolicy &p,
+           KeyIter keys_begin,
+           KeyIter keys_end,
+           ValIter vals_begin,
+           Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Values Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return;
+  }
+  impl::sort::unstable_pairs(p, keys_begin, keys_end, vals_begin, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort pairs execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[in,out] vals_begin Pointer or Random-Access Iterator to start of
+*values, reordered along with the keys
+* \param[in] comp comparison function to apply to keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare = operators::less<detail::SortIterVal<KeyIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<ValIter>>
+stable_sort_pairs(const ExecPolicy &p,
+                  KeyIter keys_begin,
+                  KeyIter keys_end,
+                  ValIter vals_begin,
+                  Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Values Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return;
+  }
+  impl::sort::stable_pairs(p, keys_begin, keys_end, vals_begin, comp);
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  sort execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] comp comparison function to apply for sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare =
+              operators::less<detail::SortContainerVal<Container>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>>
+sort(const ExecPolicy &p, Container &c, Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  if (std::begin(c) == std::end(c)) {
+    return;
+  }
+  impl::sort::unstable(p, std::begin(c), std::end(c), comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] comp comparison function to apply for sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare =
+              operators::less<detail::SortContainerVal<Container>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>>
+stable_sort(const ExecPolicy &p, Container &c, Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  if (std::begin(c) == std::end(c)) {
+    return;
+  }
+  impl::sort::stable(p, std::begin(c), std::end(c), comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sort pairs execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys Random-Access Container of keys
+* \param[in,out] vals Random-Access Container of values, at least as long as
+*keys
+* \param[in] comp comparison function to apply to keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare =
+              operators::less<detail::SortContainerVal<KeyContainer>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<KeyContainer>,
+                    type_traits::is_range<ValContainer>>
+sort_pairs(const ExecPolicy &p,
+           KeyContainer &keys,
+           ValContainer &vals,
+           Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "Keys Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "Values Container must model RandomAccessRange");
+  if (std::begin(keys) == std::end(keys)) {
+    return;
+  }
+  impl::sort::unstable_pairs(
+      p, std::begin(keys), std::end(keys), std::begin(vals), comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort pairs execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys Random-Access Container of keys
+* \param[in,out] vals Random-Access Container of values, at least as long as
+*keys
+* \param[in] comp comparison function to apply to keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare =
+              operators::less<detail::SortContainerVal<KeyContainer>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<KeyContainer>,
+                    type_traits::is_range<ValContainer>>
+stable_sort_pairs(const ExecPolicy &p,
+                  KeyContainer &keys,
+                  ValContainer &vals,
+                  Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "Keys Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "Values Container must model RandomAccessRange");
+  if (std::begin(keys) == std::end(keys)) {
+    return;
+  }
+  impl::sort::stable_pairs(
+      p, std::begin(keys), std::end(keys), std::begin(vals), comp);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+sort(Args &&... args)
+{
+  ::RAJA::sort(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+stable_sort(Args &&... args)
+{
+  ::RAJA::stable_sort(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+sort_pairs(Args &&... args)
+{
+  ::RAJA::sort_pairs(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+stable_sort_pairs(Args &&... args)
+{
+  ::RAJA::stable_sort_pairs(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -36,7 +36,8 @@ enum class Policy {
   cuda,
   hip,
   sycl,
-  tbb
+  tbb,
+  threads
 };
 
 enum class Pattern {
@@ -169,6 +170,9 @@ template <typename Pol>
 struct is_tbb_policy : RAJA::policy_is<Pol, RAJA::Policy::tbb> {
 };
 template <typename Pol>
+struct is_threads_policy : RAJA::policy_is<Pol, RAJA::Policy::threads> {
+};
+template <typename Pol>
 struct is_target_openmp_policy
     : RAJA::policy_is<Pol, RAJA::Policy::target_openmp> {
 };
@@ -22,6 +22,7 @@
 
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/policy/atomic_builtin.hpp"
 #include "RAJA/policy/sequential/atomic.hpp"
 
 /*!
@@ -33,6 +34,9 @@
  * Next, if OpenMP is enabled we always use the omp_atomic, which should
  * generally work everywhere.
  *
+ * Then, if the native thread pool is enabled we use the builtin_atomic,
+ * since its threads need real atomics as well.
+ *
  * Finally, we fallback on the seq_atomic, which performs non-atomic operations
  * because we assume there is no thread safety issues (no parallel model)
  */
@@ -45,6 +49,9 @@
 #elif defined(RAJA_ENABLE_OPENMP)
 #define RAJA_AUTO_ATOMIC \
   RAJA::omp_atomic {}
+#elif defined(RAJA_ENABLE_THREADS)
+#define RAJA_AUTO_ATOMIC \
+  RAJA::builtin_atomic {}
 #else
 #define RAJA_AUTO_ATOMIC \
   RAJA::seq_atomic {}
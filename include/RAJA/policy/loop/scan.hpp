@@ -28,6 +28,8 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/pattern/detail/segmented_scan.hpp"
+
 #include "RAJA/policy/loop/policy.hpp"
 
 namespace RAJA
@@ -47,10 +49,11 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive_inplace(
     Iter end,
     BinFn f)
 {
-  auto agg = *begin;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  Value agg = *begin;
 
   for (Iter i = ++begin; i != end; ++i) {
-    agg = f(*i, agg);
+    agg = f(agg, *i);
     *i = agg;
   }
 }
@@ -67,12 +70,12 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive_inplace(
     BinFn f,
     T v)
 {
-  const int n = end - begin;
-  decltype(*begin) agg = v;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  Value agg = v;
 
-  for (int i = 0; i < n; ++i) {
-    auto t = *(begin + i);
-    *(begin + i) = agg;
+  for (Iter i = begin; i != end; ++i) {
+    Value t = *i;
+    *i = agg;
     agg = f(agg, t);
   }
 }
@@ -89,7 +92,8 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive(
     OutIter out,
     BinFn f)
 {
-  auto agg = *begin;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  Value agg = *begin;
   *out++ = agg;
 
   for (Iter i = begin + 1; i != end; ++i) {
@@ -115,16 +119,102 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive(
     BinFn f,
     T v)
 {
-  decltype(*begin) agg = v;
-  OutIter o = out;
-  *o++ = v;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  Value agg = v;
 
-  for (Iter i = begin; i != end - 1; ++i, ++o) {
-    agg = f(*i, agg);
-    *o = agg;
+  for (Iter i = begin; i != end; ++i) {
+    *out++ = agg;
+    agg = f(agg, *i);
   }
 }
 
+/*!
+        \brief explicit inclusive segmented scan given key range, values,
+   output, and function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename OutIter,
+          typename BinFn>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+inclusive_segmented(const ExecPolicy &,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    OutIter out,
+                    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<ValIter>::value_type;
+  using DiffType = typename ::std::iterator_traits<KeyIter>::difference_type;
+  namespace seg = ::RAJA::detail::segmented;
+  using Body = seg::inclusive_body<KeyIter, ValIter, OutIter, BinFn>;
+  Body{keys_begin, vals_begin, out, f}(
+      DiffType(0),
+      keys_end - keys_begin,
+      seg::empty_carry<Value, DiffType, BinFn>());
+}
+
+/*!
+        \brief explicit exclusive segmented scan given key range, values,
+   output, function, and initial value
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+exclusive_segmented(const ExecPolicy &,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    OutIter out,
+                    BinFn f,
+                    T v)
+{
+  using Value = typename ::std::iterator_traits<ValIter>::value_type;
+  using DiffType = typename ::std::iterator_traits<KeyIter>::difference_type;
+  namespace seg = ::RAJA::detail::segmented;
+  using Body = seg::exclusive_body<KeyIter, ValIter, OutIter, BinFn, T>;
+  Body{keys_begin, vals_begin, out, f, v}(
+      DiffType(0),
+      keys_end - keys_begin,
+      seg::empty_carry<Value, DiffType, BinFn>());
+}
+
+/*!
+        \brief explicit reduce by key given key range, values, outputs, and
+   function; returns the number of segments
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+typename std::enable_if<
+    type_traits::is_loop_policy<ExecPolicy>::value,
+    typename ::std::iterator_traits<KeyIter>::difference_type>::type
+reduce_by_key(const ExecPolicy &,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              ValIter vals_begin,
+              KeyOutIter keys_out,
+              ValOutIter vals_out,
+              BinFn f)
+{
+  using Value = typename ::std::iterator_traits<ValIter>::value_type;
+  using DiffType = typename ::std::iterator_traits<KeyIter>::difference_type;
+  namespace seg = ::RAJA::detail::segmented;
+  using Body =
+      seg::reduce_by_key_body<KeyIter, ValIter, KeyOutIter, ValOutIter, BinFn>;
+  const DiffType n = keys_end - keys_begin;
+  return Body{keys_begin, vals_begin, keys_out, vals_out, f, n}(
+      DiffType(0), n, seg::empty_carry<Value, DiffType, BinFn>());
+}
+
 }  // namespace scan
 
 }  // namespace impl
@@ -116,6 +116,54 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
   }
 }
 
+///
+/// OpenMP parallel for dynamic policy implementation
+///
+
+template <typename Iterable, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_dynamic<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(dynamic, ChunkSize)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+///
+/// OpenMP parallel for guided policy implementation
+///
+
+template <typename Iterable, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_guided<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(guided, ChunkSize)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+///
+/// OpenMP parallel for runtime schedule policy implementation
+///
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_runtime&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(runtime)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -126,67 +174,148 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace detail
+{
+
+/*!
+ * \brief  Runs segment seg of a dependency graph and then the segments
+ *         that become ready when it finishes. All but one of them are
+ *         started as new tasks; this task continues with the last one.
+ */
+template <typename Func>
+void taskgraph_run(DepGraph* graph, int seg, Func const* seg_body)
+{
+  while (seg >= 0) {
+    {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(*seg_body);
+      privatizer.get_priv()(seg);
+    }
+
+    // the task outlives this frame, so it gets its own copies
+    int next = -1;
+    graph->complete(seg, [&next, graph, seg_body](int ready) {
+      if (next >= 0) {
+        const int spawn = next;
+        DepGraph* const spawn_graph = graph;
+        Func const* const spawn_body = seg_body;
+#pragma omp task firstprivate(spawn, spawn_graph, spawn_body)
+        taskgraph_run(spawn_graph, spawn, spawn_body);
+      }
+      next = ready;
+    });
+    seg = next;
+  }
+}
+
+//! checks that the index set has a dependency graph for all its segments
+template <typename... SegmentTypes>
+DepGraph* taskgraph_get(const TypedIndexSet<SegmentTypes...>& iset)
+{
+  if (!iset.dependencyGraphSet()) {
+    return nullptr;
+  }
+  DepGraph* graph = iset.getDependencyGraph();
+  if (graph->size() != static_cast<int>(iset.getNumSegments())) {
+    RAJA_ABORT_OR_THROW(
+        "RAJA IndexSet dependency graph does not match its segments");
+  }
+  return graph;
+}
+
+}  // namespace detail
+
 /*!
  ******************************************************************************
  *
- * \brief  Iterate over index set segments using an omp parallel loop and
- *         segment dependency graph. Individual segment execution will use
- *         execution policy template parameter.
+ * \brief  Iterate over index set segments as OpenMP tasks that start as
+ *         soon as the segments they depend on have finished. Individual
+ *         segment execution will use the segment execution policy.
  *
- *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ *         The dependency graph is set up once with the index set
+ *         initDependencyGraph() and finalizeDependencyGraph() methods and
+ *         replayed by every loop. Threads never wait on a segment; the
+ *         task that satisfies the last dependency of a segment runs it.
+ *         Without a dependency graph all segments are independent.
  *
  ******************************************************************************
  */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE void forall_impl(const omp_taskgraph_segit&,
+                             const TypedIndexSet<SegmentTypes...>& iset,
+                             Func&& loop_body)
+{
+  DepGraph* graph = detail::taskgraph_get(iset);
+  if (!graph) {
+    forall_impl(omp_parallel_for_exec{}, iset, loop_body);
+    return;
+  }
 
-/*
- * TODO: Fix this!!!
- */
+  graph->reset();
+  const int num_seg = graph->size();
+  auto const* seg_body = &loop_body;
+
+#pragma omp parallel
+#pragma omp single nowait
+  {
+    for (int seg = 0; seg < num_seg; ++seg) {
+      if (graph->getNode(seg)->semaphoreReloadValue() == 0) {
+#pragma omp task firstprivate(seg)
+        detail::taskgraph_run(graph, seg, seg_body);
+      }
+    }
+  }
+}
 
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments with each OpenMP thread running
+ *         one contiguous interval of segments in order, waiting for the
+ *         dependencies of each segment before running it. Individual
+ *         segment execution will use the segment execution policy.
+ *
+ *         This suits graphs such as lock-free block index sets, where each
+ *         thread owns neighboring segments and only waits on the threads
+ *         next to it. Without a dependency graph all segments are
+ *         independent.
+ *
+ ******************************************************************************
+ */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE void forall_impl(const omp_taskgraph_interval_segit&,
+                             const TypedIndexSet<SegmentTypes...>& iset,
+                             Func&& loop_body)
 {
-  if (!iset.dependencyGraphSet()) {
-    std::cerr << "\n RAJA IndexSet dependency graph not set , "
-              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
-    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
+  DepGraph* graph = detail::taskgraph_get(iset);
+  if (!graph) {
+    forall_impl(omp_parallel_for_exec{}, iset, loop_body);
+    return;
   }
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
-
-  int num_seg = ncis.getNumSegments();
+  graph->reset();
+  const int num_seg = graph->size();
 
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
+#pragma omp parallel
+  {
+    const int num_threads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const int seg_begin = num_seg * tid / num_threads;
+    const int seg_end = num_seg * (tid + 1) / num_threads;
 
-    task->wait();
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto& body = privatizer.get_priv();
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+    for (int seg = seg_begin; seg < seg_end; ++seg) {
+      graph->getNode(seg)->wait();
 
-    task->reset();
+      body(seg);
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
-      }
+      graph->complete(seg, [](int) {});
     }
-
-  }  // iterate over segments of index set
+  }
 }
-*/
 
 }  // namespace omp
 
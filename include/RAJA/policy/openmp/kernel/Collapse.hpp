@@ -22,6 +22,8 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <omp.h>
+
 #include "RAJA/pattern/detail/privatizer.hpp"
 
 #include "RAJA/pattern/kernel/Collapse.hpp"
@@ -33,12 +35,6 @@
 #include "RAJA/policy/openmp/policy.hpp"
 
 
-#if !defined(RAJA_COMPILER_MSVC)
-#define RAJA_COLLAPSE(X) collapse(X)
-#else
-#define RAJA_COLLAPSE(X)
-#endif
-
 namespace RAJA
 {
 
@@ -51,99 +47,109 @@ struct omp_parallel_collapse_exec
 namespace internal
 {
 
+//
+// Sets the segment types of all collapsed arguments
+//
+template <typename Types, typename Data, camp::idx_t... Args>
+struct OmpCollapseTypes {
+  using type = Types;
+};
+
+template <typename Types,
+          typename Data,
+          camp::idx_t Arg0,
+          camp::idx_t... ArgRest>
+struct OmpCollapseTypes<Types, Data, Arg0, ArgRest...> {
+  using type =
+      typename OmpCollapseTypes<setSegmentTypeFromData<Types, Arg0, Data>,
+                                Data,
+                                ArgRest...>::type;
+};
+
+
 /////////
-// Collapsing two loops
+// Collapsing any number of loops
+//
+// The iteration space of the collapsed loops is flattened once and each
+// thread gets one contiguous chunk of it. A thread decomposes the start of
+// its chunk into loop indices and then advances them like an odometer, so
+// no division or modulo is done per iteration, unlike the loops generated
+// for an OpenMP collapse clause.
 /////////
 
-template <camp::idx_t Arg0, camp::idx_t Arg1, typename... EnclosedStmts, typename Types>
+template <camp::idx_t... Args, typename... EnclosedStmts, typename Types>
 struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
-                                             ArgList<Arg0, Arg1>,
+                                             ArgList<Args...>,
                                              EnclosedStmts...>, Types> {
 
+  static constexpr int num_args = sizeof...(Args);
+  static_assert(num_args > 0, "Collapse requires at least one argument");
 
-  template <typename Data>
-  static RAJA_INLINE void exec(Data&& data)
+  template <typename Data, camp::idx_t... Pos>
+  static RAJA_INLINE void assign_offsets(Data& data,
+                                         Index_type const* idx,
+                                         camp::idx_seq<Pos...>)
   {
-    const auto l0 = segment_length<Arg0>(data);
-    const auto l1 = segment_length<Arg1>(data);
-    // NOTE: these are here to avoid a use-after-scope detected by address
-    // sanitizer, probably a false positive, but the result should be
-    // essentially identical
-    auto i0 = l0;
-    auto i1 = l1;
-
-    // Set the argument types for this loop
-    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
-    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
-
-    using RAJA::internal::thread_privatize;
-    auto privatizer = thread_privatize(data);
-#pragma omp parallel for private(i0, i1) firstprivate(privatizer) \
-    RAJA_COLLAPSE(2)
-    for (i0 = 0; i0 < l0; ++i0) {
-      for (i1 = 0; i1 < l1; ++i1) {
-        auto& private_data = privatizer.get_priv();
-        private_data.template assign_offset<Arg0>(i0);
-        private_data.template assign_offset<Arg1>(i1);
-        execute_statement_list<camp::list<EnclosedStmts...>, NewTypes1>(private_data);
-      }
-    }
+    camp::sink((data.template assign_offset<Args>(idx[Pos]), 0)...);
   }
-};
-
-
-template <camp::idx_t Arg0,
-          camp::idx_t Arg1,
-          camp::idx_t Arg2,
-          typename... EnclosedStmts,
-          typename Types>
-struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
-                                             ArgList<Arg0, Arg1, Arg2>,
-                                             EnclosedStmts...>, Types> {
-
 
   template <typename Data>
   static RAJA_INLINE void exec(Data&& data)
   {
-    const auto l0 = segment_length<Arg0>(data);
-    const auto l1 = segment_length<Arg1>(data);
-    const auto l2 = segment_length<Arg2>(data);
-    auto i0 = l0;
-    auto i1 = l1;
-    auto i2 = l2;
+    const Index_type len[num_args] = {
+        static_cast<Index_type>(segment_length<Args>(data))...};
+
+    Index_type total = 1;
+    for (int d = 0; d < num_args; ++d) {
+      if (len[d] <= 0) {
+        return;
+      }
+      total *= len[d];
+    }
 
     // Set the argument types for this loop
-    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
-    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
-    using NewTypes2 = setSegmentTypeFromData<NewTypes1, Arg2, Data>;
+    using NewTypes = typename OmpCollapseTypes<Types, Data, Args...>::type;
 
     using RAJA::internal::thread_privatize;
     auto privatizer = thread_privatize(data);
-#pragma omp parallel for private(i0, i1, i2) firstprivate(privatizer) \
-    RAJA_COLLAPSE(3)
-    for (i0 = 0; i0 < l0; ++i0) {
-      for (i1 = 0; i1 < l1; ++i1) {
-        for (i2 = 0; i2 < l2; ++i2) {
-          auto& private_data = privatizer.get_priv();
-          private_data.template assign_offset<Arg0>(i0);
-          private_data.template assign_offset<Arg1>(i1);
-          private_data.template assign_offset<Arg2>(i2);
-          execute_statement_list<camp::list<EnclosedStmts...>, NewTypes2>(private_data);
+#pragma omp parallel firstprivate(privatizer)
+    {
+      const Index_type nthreads = omp_get_num_threads();
+      const Index_type tid = omp_get_thread_num();
+      const Index_type chunk = total / nthreads;
+      const Index_type rem = total % nthreads;
+      const Index_type begin = tid * chunk + (tid < rem ? tid : rem);
+      const Index_type end = begin + chunk + (tid < rem ? 1 : 0);
+
+      if (begin < end) {
+        Index_type idx[num_args];
+        Index_type r = begin;
+        for (int d = num_args - 1; d >= 0; --d) {
+          idx[d] = r % len[d];
+          r /= len[d];
+        }
+
+        auto& private_data = privatizer.get_priv();
+        for (Index_type k = begin; k < end; ++k) {
+          assign_offsets(private_data, idx, camp::make_idx_seq_t<num_args>{});
+          execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(
+              private_data);
+
+          for (int d = num_args - 1; d >= 0; --d) {
+            if (++idx[d] < len[d] || d == 0) {
+              break;
+            }
+            idx[d] = 0;
+          }
         }
       }
     }
   }
 };
 
-
-
-
-
 }  // namespace internal
 }  // namespace RAJA
 
-#undef RAJA_COLLAPSE
-
 #endif  // closing endif for RAJA_ENABLE_OPENMP guard
 
 #endif  // closing endif for header file include guard
@@ -46,6 +46,20 @@ template <unsigned int ChunkSize>
 struct Static : std::integral_constant<unsigned int, ChunkSize> {
 };
 
+template <unsigned int ChunkSize>
+struct Dynamic : std::integral_constant<unsigned int, ChunkSize> {
+};
+
+template <unsigned int ChunkSize>
+struct Guided : std::integral_constant<unsigned int, ChunkSize> {
+};
+
+struct Runtime {
+};
+
+struct Team {
+};
+
 
 //
 //////////////////////////////////////////////////////////////////////
@@ -62,6 +76,15 @@ struct omp_parallel_region
                                             Platform::host> {
 };
 
+//! persistent thread team that runs the omp_team_* loops of its body
+struct omp_team_region
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Team> {
+};
+
 struct omp_for_exec
     : make_policy_pattern_t<Policy::openmp, Pattern::forall, omp::For> {
 };
@@ -84,6 +107,58 @@ struct omp_for_static : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                               omp::Static<N>> {
 };
 
+template <unsigned int N = 1>
+struct omp_for_dynamic
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For,
+                                            omp::Dynamic<N>> {
+};
+
+template <unsigned int N = 1>
+struct omp_for_guided
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For,
+                                            omp::Guided<N>> {
+};
+
+//! schedule kind and chunk size are taken from OMP_SCHEDULE or
+//! omp_set_schedule() when the loop runs
+struct omp_for_runtime
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For,
+                                            omp::Runtime> {
+};
+
+//! static loop on the team of the enclosing omp_team_region
+struct omp_team_for_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Team,
+                                            omp::For> {
+};
+
+//! omp_team_for_exec that does not wait for the other team threads
+struct omp_team_for_nowait_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Team,
+                                            omp::For,
+                                            omp::NoWait> {
+};
+
 
 template <typename InnerPolicy>
 struct omp_parallel_exec
@@ -102,6 +177,17 @@ template <unsigned int N>
 struct omp_parallel_for_static : omp_parallel_exec<omp_for_static<N>> {
 };
 
+template <unsigned int N = 1>
+struct omp_parallel_for_dynamic : omp_parallel_exec<omp_for_dynamic<N>> {
+};
+
+template <unsigned int N = 1>
+struct omp_parallel_for_guided : omp_parallel_exec<omp_for_guided<N>> {
+};
+
+struct omp_parallel_for_runtime : omp_parallel_exec<omp_for_runtime> {
+};
+
 
 ///
 /// Index set segment iteration policies
@@ -139,20 +225,42 @@ struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Launch::sync> {
 };
 
+//! waits for every loop posted to the enclosing omp_team_region
+struct omp_team_synchronize
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::synchronize,
+                                            Launch::sync,
+                                            Platform::host,
+                                            omp::Team> {
+};
+
 }  // namespace omp
 }  // namespace policy
 
+using policy::omp::omp_for_dynamic;
 using policy::omp::omp_for_exec;
+using policy::omp::omp_for_guided;
 using policy::omp::omp_for_nowait_exec;
+using policy::omp::omp_for_runtime;
 using policy::omp::omp_for_static;
 using policy::omp::omp_parallel_exec;
+using policy::omp::omp_parallel_for_dynamic;
 using policy::omp::omp_parallel_for_exec;
+using policy::omp::omp_parallel_for_guided;
+using policy::omp::omp_parallel_for_runtime;
+using policy::omp::omp_parallel_for_static;
 using policy::omp::omp_parallel_for_segit;
 using policy::omp::omp_parallel_region;
 using policy::omp::omp_parallel_segit;
 using policy::omp::omp_reduce;
 using policy::omp::omp_reduce_ordered;
 using policy::omp::omp_synchronize;
+using policy::omp::omp_taskgraph_interval_segit;
+using policy::omp::omp_taskgraph_segit;
+using policy::omp::omp_team_for_exec;
+using policy::omp::omp_team_for_nowait_exec;
+using policy::omp::omp_team_region;
+using policy::omp::omp_team_synchronize;
 
 
 
@@ -25,13 +25,15 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
-#include <memory>
-#include <vector>
+#include <algorithm>
+#include <new>
 
 #include <omp.h>
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
@@ -42,31 +44,369 @@ namespace RAJA
 
 namespace detail
 {
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Per-thread partial results for OpenMP reducers.
+ *
+ *         One slot is allocated per OpenMP thread and each slot is padded
+ *         to DATA_ALIGN bytes, so threads folding their private reducer
+ *         copies back never share a cache line. A thread only ever writes
+ *         its own slot, which makes the combine lock-free.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class OmpReduceSlots
+{
+  struct RAJA_ALIGNED_ATTR(DATA_ALIGN) Slot {
+    T value;
+  };
+
+  Slot* m_slots;
+  int m_num_slots;
+
+public:
+  explicit OmpReduceSlots(T const& identity)
+      : m_slots(nullptr), m_num_slots(omp_get_max_threads())
+  {
+    m_slots = allocate_aligned_type<Slot>(DATA_ALIGN,
+                                          m_num_slots * sizeof(Slot));
+    for (int i = 0; i < m_num_slots; ++i) {
+      new (&m_slots[i]) Slot{identity};
+    }
+  }
+
+  ~OmpReduceSlots()
+  {
+    for (int i = 0; i < m_num_slots; ++i) {
+      m_slots[i].~Slot();
+    }
+    free_aligned(m_slots);
+  }
+
+  OmpReduceSlots(OmpReduceSlots const&) = delete;
+  OmpReduceSlots& operator=(OmpReduceSlots const&) = delete;
+
+  int size() const { return m_num_slots; }
+
+  T& at(int i) const { return m_slots[i].value; }
+
+  /*!
+   *  \return pointer to the calling thread's slot, or nullptr if the
+   *          thread has none (nested parallelism or a team larger than
+   *          omp_get_max_threads() at construction).
+   */
+  T* local() const
+  {
+    if (omp_get_level() > 1) {
+      return nullptr;
+    }
+    int tid = omp_get_thread_num();
+    return (tid < m_num_slots) ? &m_slots[tid].value : nullptr;
+  }
+
+  /*!
+   *  \brief fold every slot into val in thread order and clear the slots.
+   */
+  template <typename Reduce>
+  void fold(T& val, T const& identity) const
+  {
+    for (int i = 0; i < m_num_slots; ++i) {
+      Reduce{}(val, m_slots[i].value);
+      m_slots[i].value = identity;
+    }
+  }
+
+  /*!
+   *  \brief fold every slot into val in thread order, leaving the slots
+   *         untouched.
+   */
+  template <typename Reduce>
+  void accumulate(T& val) const
+  {
+    for (int i = 0; i < m_num_slots; ++i) {
+      Reduce{}(val, m_slots[i].value);
+    }
+  }
+
+  void reset(T const& identity)
+  {
+    for (int i = 0; i < m_num_slots; ++i) {
+      m_slots[i].value = identity;
+    }
+  }
+};
+
 template <typename T, typename Reduce>
 class ReduceOMP
     : public reduce::detail::BaseCombinable<T, Reduce, ReduceOMP<T, Reduce>>
 {
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMP>;
 
+  //! per-thread partial results, owned by the parent reducer
+  OmpReduceSlots<T>* slots;
+
 public:
-  using Base::Base;
   //! prohibit compiler-generated default ctor
   ReduceOMP() = delete;
 
+  ReduceOMP(T init_val, T identity_ = T())
+      : Base(init_val, identity_), slots(new OmpReduceSlots<T>(identity_))
+  {
+  }
+
+  ReduceOMP(ReduceOMP const& other) : Base(other), slots(other.slots) {}
+
   ~ReduceOMP()
   {
     if (Base::parent) {
+      if (Base::my_data != Base::identity) {
+        T* slot = slots->local();
+        if (slot) {
+          Reduce()(*slot, Base::my_data);
+        } else {
 #pragma omp critical(ompReduceCritical)
-      Reduce()(Base::parent->local(), Base::my_data);
+          Reduce()(Base::parent->local(), Base::my_data);
+        }
+      }
       Base::my_data = Base::identity;
+    } else {
+      delete slots;
     }
   }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    slots->reset(identity_);
+  }
+
+  T get_combined() const
+  {
+    if (!Base::parent) {
+      slots->template fold<Reduce>(Base::my_data, Base::identity);
+    }
+    return Base::my_data;
+  }
 };
 
 }  // namespace detail
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce, detail::ReduceOMP)
 
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Bin storage for OpenMP array reducers.
+ *
+ *         Each thread gets a private, DATA_ALIGN-aligned copy of the bins
+ *         the first time one of its reducer copies is updated; the copy
+ *         is kept and reused by later loops. Reading the result merges
+ *         the private copies in thread order, in parallel over blocks of
+ *         bins.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce>
+class ReduceOMPArray
+{
+  //! bins are merged in blocks of this many per OpenMP iteration
+  static constexpr Index_type merge_block = 2048;
+
+  struct PrivateBins {
+    T* bins;
+    bool touched;
+  };
+
+  //! state shared by the parent reducer and all of its copies
+  struct State {
+    State(Index_type num_bins, T init_val, T identity_)
+        : size(num_bins),
+          identity(identity_),
+          result(new T[num_bins]),
+          slots(PrivateBins{nullptr, false})
+    {
+      std::fill_n(result, size, init_val);
+    }
+
+    ~State()
+    {
+      for (int t = 0; t < slots.size(); ++t) {
+        free_bins(slots.at(t).bins);
+      }
+      delete[] result;
+    }
+
+    T* allocate_bins() const
+    {
+      T* bins = allocate_aligned_type<T>(DATA_ALIGN, size * sizeof(T));
+      for (Index_type b = 0; b < size; ++b) {
+        new (&bins[b]) T(identity);
+      }
+      return bins;
+    }
+
+    void free_bins(T* bins) const
+    {
+      if (bins) {
+        for (Index_type b = 0; b < size; ++b) {
+          bins[b].~T();
+        }
+        free_aligned(bins);
+      }
+    }
+
+    Index_type size;
+    T identity;
+    T* result;
+    OmpReduceSlots<PrivateBins> slots;
+  };
+
+  State* m_state;
+  bool m_owner;
+  //! bins updated by this object, looked up on first use
+  T mutable* m_local;
+  //! private bins of a copy that has no thread slot (nested parallelism)
+  T mutable* m_own;
+  PrivateBins mutable* m_slot;
+
+  T* acquire() const
+  {
+    if (m_owner) {
+      return m_state->result;
+    }
+    m_slot = m_state->slots.local();
+    if (m_slot) {
+      if (!m_slot->bins) {
+        m_slot->bins = m_state->allocate_bins();
+      }
+      m_slot->touched = true;
+      return m_slot->bins;
+    }
+    m_own = m_state->allocate_bins();
+    return m_own;
+  }
+
+  void merge() const
+  {
+    State& st = *m_state;
+    const int num_slots = st.slots.size();
+
+    bool any = false;
+    for (int t = 0; t < num_slots; ++t) {
+      any = any || st.slots.at(t).touched;
+    }
+    if (!any) {
+      return;
+    }
+
+    const Index_type num_blocks = (st.size + merge_block - 1) / merge_block;
+#pragma omp parallel for schedule(static) if (num_blocks > 1)
+    for (Index_type blk = 0; blk < num_blocks; ++blk) {
+      const Index_type lo = blk * merge_block;
+      const Index_type hi = std::min(st.size, lo + merge_block);
+      for (int t = 0; t < num_slots; ++t) {
+        PrivateBins& p = st.slots.at(t);
+        if (p.touched) {
+          for (Index_type b = lo; b < hi; ++b) {
+            Reduce{}(st.result[b], p.bins[b]);
+            p.bins[b] = st.identity;
+          }
+        }
+      }
+    }
+
+    for (int t = 0; t < num_slots; ++t) {
+      st.slots.at(t).touched = false;
+    }
+  }
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceOMPArray() = delete;
+
+  ReduceOMPArray(Index_type num_bins, T init_val, T identity_)
+      : m_state(new State(num_bins, init_val, identity_)),
+        m_owner(true),
+        m_local(nullptr),
+        m_own(nullptr),
+        m_slot(nullptr)
+  {
+  }
+
+  ReduceOMPArray(ReduceOMPArray const& other)
+      : m_state(other.m_state),
+        m_owner(false),
+        m_local(nullptr),
+        m_own(nullptr),
+        m_slot(nullptr)
+  {
+  }
+
+  ~ReduceOMPArray()
+  {
+    if (m_slot) {
+      // mark again in case the result was read while this copy was alive
+      m_slot->touched = true;
+    }
+    if (m_own) {
+#pragma omp critical(ompReduceCritical)
+      for (Index_type b = 0; b < m_state->size; ++b) {
+        Reduce{}(m_state->result[b], m_own[b]);
+      }
+      m_state->free_bins(m_own);
+    }
+    if (m_owner) {
+      delete m_state;
+    }
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    State& st = *m_state;
+    st.identity = identity_;
+    std::fill_n(st.result, st.size, init_val);
+    for (int t = 0; t < st.slots.size(); ++t) {
+      PrivateBins& p = st.slots.at(t);
+      if (p.bins) {
+        std::fill_n(p.bins, st.size, identity_);
+      }
+      p.touched = false;
+    }
+  }
+
+  Index_type size() const { return m_state->size; }
+
+  T& local(Index_type bin) const
+  {
+    if (!m_local) {
+      m_local = acquire();
+    }
+    return m_local[bin];
+  }
+
+  T get(Index_type bin) const
+  {
+    merge();
+    return m_state->result[bin];
+  }
+
+  void get_all(T* out) const
+  {
+    merge();
+    std::copy_n(m_state->result, m_state->size, out);
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_ARRAY_REDUCERS(omp_reduce, detail::ReduceOMPArray)
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // Old ordered reductions are included below.
@@ -81,41 +421,62 @@ class ReduceOMPOrdered
           BaseCombinable<T, Reduce, ReduceOMPOrdered<T, Reduce>>
 {
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPOrdered>;
-  std::shared_ptr<std::vector<T>> data;
+
+  //! per-thread partial results, owned by the parent reducer and reused
+  //! across resets
+  OmpReduceSlots<T>* slots;
 
 public:
-  ReduceOMPOrdered() { reset(T(), T()); }
+  ReduceOMPOrdered() : Base(T(), T()), slots(new OmpReduceSlots<T>(T())) {}
 
   //! constructor requires a default value for the reducer
   explicit ReduceOMPOrdered(T init_val, T identity_)
+      : Base(init_val, identity_), slots(new OmpReduceSlots<T>(identity_))
+  {
+  }
+
+  ReduceOMPOrdered(ReduceOMPOrdered const& other)
+      : Base(other), slots(other.slots)
   {
-    reset(init_val, identity_);
   }
 
   void reset(T init_val, T identity_)
   {
     Base::reset(init_val, identity_);
-    data = std::shared_ptr<std::vector<T>>(
-        std::make_shared<std::vector<T>>(omp_get_max_threads(), identity_));
+    slots->reset(identity_);
   }
 
   ~ReduceOMPOrdered()
   {
-    Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
-    Base::my_data = Base::identity;
+    if (Base::parent) {
+      if (Base::my_data != Base::identity) {
+        T* slot = slots->local();
+        if (slot) {
+          Reduce{}(*slot, Base::my_data);
+        } else {
+#pragma omp critical(ompReduceCritical)
+          Reduce{}(Base::parent->local(), Base::my_data);
+        }
+      }
+      Base::my_data = Base::identity;
+    } else {
+      delete slots;
+    }
   }
 
   T get_combined() const
   {
     if (Base::my_data != Base::identity) {
-      Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
-      Base::my_data = Base::identity;
+      T* slot = slots->local();
+      if (slot) {
+        Reduce{}(*slot, Base::my_data);
+        Base::my_data = Base::identity;
+      }
     }
 
     T res = Base::identity;
-    for (size_t i = 0; i < data->size(); ++i) {
-      Reduce{}(res, (*data)[i]);
-    }
+    slots->template accumulate<Reduce>(res);
+    Reduce{}(res, Base::my_data);
     return res;
   }
 };
@@ -124,6 +485,8 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce_ordered, detail::ReduceOMPOrdered)
 
+RAJA_DECLARE_ALL_ARRAY_REDUCERS(omp_reduce_ordered, detail::ReduceOMPArray)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_OPENMP guard
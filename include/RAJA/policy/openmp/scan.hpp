@@ -28,6 +28,8 @@
 
 #include <omp.h>
 
+#include "RAJA/pattern/detail/segmented_scan.hpp"
+
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/scan.hpp"
 
@@ -38,12 +40,170 @@ namespace impl
 namespace scan
 {
 
-RAJA_INLINE
-int firstIndex(int n, int p, int pid)
+namespace detail
+{
+
+//! bytes of data each thread scans per round; sized to stay in L2 cache
+constexpr size_t scan_block_bytes = 128 * 1024;
+
+/*!
+ * \brief  Blocked reduce-then-scan over [in, in + n) into out.
+ *
+ *         The range is processed in rounds of one cache-sized block per
+ *         thread. Each thread reduces its block, the block totals are
+ *         combined after a single barrier, and each thread then scans its
+ *         block while it is still in cache, so a large scan reads and
+ *         writes the data from memory only about once. in and out may be
+ *         the same range.
+ */
+template <typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename Value,
+          bool Inclusive>
+void scan_blocked(Iter in,
+                  typename ::std::iterator_traits<Iter>::difference_type n,
+                  OutIter out,
+                  BinFn f,
+                  Value init,
+                  std::integral_constant<bool, Inclusive>)
+{
+  using diff_type = typename ::std::iterator_traits<Iter>::difference_type;
+
+  const diff_type max_block = std::max<diff_type>(
+      1, static_cast<diff_type>(scan_block_bytes / sizeof(Value)));
+  const int p0 = static_cast<int>(
+      std::min<diff_type>(n, static_cast<diff_type>(omp_get_max_threads())));
+
+  // block totals, double buffered so that one barrier per round suffices
+  ::std::vector<Value> sums(2 * p0, init);
+
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const diff_type block = std::min<diff_type>(max_block, (n + p - 1) / p);
+    const diff_type stride = block * p;
+
+    Value carry = init;
+
+    for (diff_type base = 0, round = 0; base < n; base += stride, ++round) {
+      Value* round_sums = sums.data() + (round % 2) * p;
+      const diff_type i0 = std::min<diff_type>(n, base + block * pid);
+      const diff_type i1 = std::min<diff_type>(n, i0 + block);
+
+      Value agg = BinFn::identity();
+      for (diff_type i = i0; i < i1; ++i) {
+        agg = f(agg, *(in + i));
+      }
+      round_sums[pid] = agg;
+
+#pragma omp barrier
+
+      Value offset = carry;
+      for (int t = 0; t < pid; ++t) {
+        offset = f(offset, round_sums[t]);
+      }
+      Value next = offset;
+      for (int t = pid; t < p; ++t) {
+        next = f(next, round_sums[t]);
+      }
+
+      for (diff_type i = i0; i < i1; ++i) {
+        const Value t = *(in + i);
+        if (Inclusive) {
+          offset = f(offset, t);
+          *(out + i) = offset;
+        } else {
+          *(out + i) = offset;
+          offset = f(offset, t);
+        }
+      }
+
+      carry = next;
+    }
+  }
+}
+
+/*!
+ * \brief  Blocked segmented scan driver over the n elements of keys and
+ *         vals, using the same rounds as scan_blocked. Each thread
+ *         summarizes its block, and after the barrier runs body over the
+ *         block with the combined summary of everything before it.
+ *         Returns the summary of the whole range.
+ */
+template <typename Value,
+          typename KeyIter,
+          typename ValIter,
+          typename BinFn,
+          typename Body>
+::RAJA::detail::segmented::
+    carry<Value, typename ::std::iterator_traits<KeyIter>::difference_type>
+    segmented_blocked(
+        KeyIter keys,
+        ValIter vals,
+        typename ::std::iterator_traits<KeyIter>::difference_type n,
+        BinFn f,
+        Body const& body)
 {
-  return (static_cast<size_t>(n) * pid) / p;
+  using diff_type = typename ::std::iterator_traits<KeyIter>::difference_type;
+  namespace seg = ::RAJA::detail::segmented;
+  using carry_type = seg::carry<Value, diff_type>;
+
+  const carry_type empty = seg::empty_carry<Value, diff_type, BinFn>();
+  const diff_type max_block = std::max<diff_type>(
+      1,
+      static_cast<diff_type>(scan_block_bytes
+                             / (sizeof(Value) + sizeof(*keys))));
+  const int p0 = static_cast<int>(
+      std::min<diff_type>(n, static_cast<diff_type>(omp_get_max_threads())));
+
+  // block summaries, double buffered so that one barrier per round suffices
+  ::std::vector<carry_type> sums(2 * p0, empty);
+  carry_type total = empty;
+
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const diff_type block = std::min<diff_type>(max_block, (n + p - 1) / p);
+    const diff_type stride = block * p;
+
+    carry_type c = empty;
+
+    for (diff_type base = 0, round = 0; base < n; base += stride, ++round) {
+      carry_type* round_sums = sums.data() + (round % 2) * p;
+      const diff_type i0 = std::min<diff_type>(n, base + block * pid);
+      const diff_type i1 = std::min<diff_type>(n, i0 + block);
+
+      round_sums[pid] = seg::summarize<Value>(keys, vals, i0, i1, f);
+
+#pragma omp barrier
+
+      carry_type offset = c;
+      for (int t = 0; t < pid; ++t) {
+        offset = seg::combine(offset, round_sums[t], f);
+      }
+      carry_type next = offset;
+      for (int t = pid; t < p; ++t) {
+        next = seg::combine(next, round_sums[t], f);
+      }
+
+      body(i0, i1, offset);
+
+      c = next;
+    }
+
+    if (pid == 0) {
+      total = c;
+    }
+  }
+
+  return total;
 }
 
+}  // namespace detail
+
 /*!
         \brief explicit inclusive inplace scan given range, function, and
    initial value
@@ -56,25 +216,12 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_inplace(
     BinFn f)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, Value());
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    inclusive_inplace(::RAJA::loop_exec{}, begin + i0, begin + i1, f);
-    sums[pid] = *(begin + i1 - 1);
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        ::RAJA::loop_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
-  }
+  detail::scan_blocked(begin,
+                       end - begin,
+                       begin,
+                       f,
+                       Value(BinFn::identity()),
+                       std::true_type{});
 }
 
 /*!
@@ -90,27 +237,8 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
     ValueT v)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, v);
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + i0 - 1));
-#pragma omp barrier
-    exclusive_inplace(loop_exec{}, begin + i0, begin + i1, f, init);
-    sums[pid] = *(begin + i1 - 1);
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        loop_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
-  }
+  detail::scan_blocked(
+      begin, end - begin, begin, f, Value(v), std::false_type{});
 }
 
 /*!
@@ -119,14 +247,15 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
 */
 template <typename Policy, typename Iter, typename OutIter, typename BinFn>
 concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive(
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f)
 {
-  ::std::copy(begin, end, out);
-  inclusive_inplace(exec, out, out + (end - begin), f);
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  detail::scan_blocked(
+      begin, end - begin, out, f, Value(BinFn::identity()), std::true_type{});
 }
 
 /*!
@@ -139,15 +268,105 @@ template <typename Policy,
           typename BinFn,
           typename ValueT>
 concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive(
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f,
     ValueT v)
 {
-  ::std::copy(begin, end, out);
-  exclusive_inplace(exec, out, out + (end - begin), f, v);
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  detail::scan_blocked(begin, end - begin, out, f, Value(v), std::false_type{});
+}
+
+/*!
+        \brief explicit inclusive segmented scan given key range, values,
+   output, and function
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename OutIter,
+          typename BinFn>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_segmented(
+    const Policy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    OutIter out,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<ValIter>::value_type;
+  using Body = ::RAJA::detail::segmented::
+      inclusive_body<KeyIter, ValIter, OutIter, BinFn>;
+  detail::segmented_blocked<Value>(keys_begin,
+                                   vals_begin,
+                                   keys_end - keys_begin,
+                                   f,
+                                   Body{keys_begin, vals_begin, out, f});
+}
+
+/*!
+        \brief explicit exclusive segmented scan given key range, values,
+   output, function, and initial value
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_segmented(
+    const Policy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  using Value = typename ::std::iterator_traits<ValIter>::value_type;
+  using Body = ::RAJA::detail::segmented::
+      exclusive_body<KeyIter, ValIter, OutIter, BinFn, T>;
+  detail::segmented_blocked<Value>(keys_begin,
+                                   vals_begin,
+                                   keys_end - keys_begin,
+                                   f,
+                                   Body{keys_begin, vals_begin, out, f, v});
+}
+
+/*!
+        \brief explicit reduce by key given key range, values, outputs, and
+   function; returns the number of segments
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+typename std::enable_if<
+    type_traits::is_openmp_policy<Policy>::value,
+    typename ::std::iterator_traits<KeyIter>::difference_type>::type
+reduce_by_key(const Policy&,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              ValIter vals_begin,
+              KeyOutIter keys_out,
+              ValOutIter vals_out,
+              BinFn f)
+{
+  using Value = typename ::std::iterator_traits<ValIter>::value_type;
+  using Body = ::RAJA::detail::segmented::
+      reduce_by_key_body<KeyIter, ValIter, KeyOutIter, ValOutIter, BinFn>;
+  const auto n = keys_end - keys_begin;
+  return detail::segmented_blocked<Value>(
+             keys_begin,
+             vals_begin,
+             n,
+             f,
+             Body{keys_begin, vals_begin, keys_out, vals_out, f, n})
+      .heads;
 }
 
 }  // namespace scan
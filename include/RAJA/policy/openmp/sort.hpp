@@ -0,0 +1,152 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_openmp_HPP
+#define RAJA_sort_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+#include <omp.h>
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+//! runs sort blocks as iterations of an OpenMP parallel loop
+struct omp_blocks {
+  int num_blocks() const { return omp_get_max_threads(); }
+
+  template <typename F>
+  void run(int nblocks, F&& f) const
+  {
+#pragma omp parallel for schedule(static)
+    for (int b = 0; b < nblocks; ++b) {
+      f(b);
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> unstable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  using T = typename ::std::iterator_traits<Iter>::value_type;
+  ::RAJA::detail::sort::sort_keys<false>(
+      detail::omp_blocks{},
+      begin,
+      end,
+      comp,
+      ::RAJA::detail::sort::use_radix<T, Compare>{});
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> stable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  using T = typename ::std::iterator_traits<Iter>::value_type;
+  ::RAJA::detail::sort::sort_keys<true>(
+      detail::omp_blocks{},
+      begin,
+      end,
+      comp,
+      ::RAJA::detail::sort::use_radix<T, Compare>{});
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> unstable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  using K = typename ::std::iterator_traits<KeyIter>::value_type;
+  ::RAJA::detail::sort::sort_pairs<false>(
+      detail::omp_blocks{},
+      keys_begin,
+      keys_end,
+      vals_begin,
+      comp,
+      ::RAJA::detail::sort::use_radix<K, Compare>{});
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on
+   keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> stable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  using K = typename ::std::iterator_traits<KeyIter>::value_type;
+  ::RAJA::detail::sort::sort_pairs<true>(
+      detail::omp_blocks{},
+      keys_begin,
+      keys_end,
+      vals_begin,
+      comp,
+      ::RAJA::detail::sort::use_radix<K, Compare>{});
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
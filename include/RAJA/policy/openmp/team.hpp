@@ -0,0 +1,500 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the RAJA persistent OpenMP thread team
+ *          used by the omp_team_* region, forall and synchronize policies.
+ *
+ *          A team region opens one OpenMP parallel region. Its body runs
+ *          on the master thread only, while the other threads wait for the
+ *          master to post loops to them. Each team loop is split into one
+ *          contiguous chunk per thread, so starting a loop costs one atomic
+ *          store and finishing it one counter instead of an OpenMP fork,
+ *          join and barrier.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_team_openmp_HPP
+#define RAJA_team_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+
+#include <omp.h>
+
+#include "camp/helpers.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+
+
+namespace RAJA
+{
+namespace policy
+{
+namespace omp
+{
+
+namespace detail
+{
+
+//! spins until done() holds, yielding the core after a while
+template <typename Pred>
+RAJA_INLINE void team_spin_until(Pred&& done)
+{
+  for (int spins = 0; !done(); ++spins) {
+    if (spins >= 4096) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+/*!
+ * \brief  Iteration space of a team loop, used to decide whether a nowait
+ *         loop may start before the loop posted ahead of it has finished.
+ *
+ *         Two loops over the same range segment give every thread the same
+ *         indices, so a loop that only reads what the previous one wrote
+ *         at the same index needs no barrier between them. Any other
+ *         iterable is treated as a different space.
+ */
+struct TeamSpace {
+  bool known;
+  std::ptrdiff_t first;
+  std::ptrdiff_t size;
+
+  bool operator==(TeamSpace const& o) const
+  {
+    return known && o.known && first == o.first && size == o.size;
+  }
+};
+
+template <typename Iterable>
+RAJA_INLINE TeamSpace team_space(Iterable const&, std::ptrdiff_t size)
+{
+  return TeamSpace{false, 0, size};
+}
+
+template <typename StorageT, typename DiffT>
+RAJA_INLINE TeamSpace team_space(TypedRangeSegment<StorageT, DiffT> const& r,
+                                 std::ptrdiff_t size)
+{
+  return TeamSpace{
+      true,
+      static_cast<std::ptrdiff_t>(stripIndexType(*std::begin(r))),
+      size};
+}
+
+//! loop body and iterator of a team loop, run on [lo, hi)
+template <typename Iterator, typename Func>
+struct TeamLoopBody {
+  Iterator b;
+  Func loop_body;
+
+  static void run(void const* self, std::ptrdiff_t lo, std::ptrdiff_t hi)
+  {
+    auto const& l = *static_cast<TeamLoopBody const*>(self);
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(l.loop_body);
+    auto body = privatizer.get_priv();
+    for (auto i = lo; i != hi; ++i) {
+      body(l.b[i]);
+    }
+  }
+
+  static void destroy(void* self) { delete static_cast<TeamLoopBody*>(self); }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Persistent team of the threads of one OpenMP parallel region.
+ *
+ *         The master posts loops into a ring of max_loops slots; all
+ *         threads run the posted loops in order, thread t taking the t-th
+ *         of num_threads() contiguous chunks. Per-slot finish counters only
+ *         grow, so loop k is done on every thread once the counter of its
+ *         slot reaches (k / max_loops + 1) * num_threads(). Because a
+ *         thread runs loops in order, that also means every loop before k
+ *         is done.
+ *
+ ******************************************************************************
+ */
+class Team
+{
+  static constexpr long max_loops = 64;
+
+  struct Loop {
+    void (*run)(void const*, std::ptrdiff_t, std::ptrdiff_t);
+    void (*destroy)(void*);
+    void* body;
+    std::ptrdiff_t size;
+    bool barrier;
+  };
+
+  Loop m_loops[max_loops];
+  std::atomic<long> m_finished[max_loops];
+  char m_pad0[64];
+  std::atomic<long> m_posted;
+  std::atomic<bool> m_closed;
+  std::atomic<int> m_left;
+  char m_pad1[64];
+
+  // master only
+  int m_num_threads;
+  long m_next;
+  bool m_last_nowait;
+  TeamSpace m_last_space;
+
+  struct ThreadState {
+    Team* team;
+    bool in_loop;
+  };
+
+  static ThreadState& state()
+  {
+    static thread_local ThreadState s{nullptr, false};
+    return s;
+  }
+
+  void run_loop(long k, int tid)
+  {
+    Loop const& l = m_loops[k % max_loops];
+    if (l.barrier) {
+      wait_loop(k - 1);
+    }
+    const std::ptrdiff_t lo = l.size * tid / m_num_threads;
+    const std::ptrdiff_t hi = l.size * (tid + 1) / m_num_threads;
+    if (lo < hi) {
+      state().in_loop = true;
+      l.run(l.body, lo, hi);
+      state().in_loop = false;
+    }
+    m_finished[k % max_loops].fetch_add(1, std::memory_order_release);
+  }
+
+  void wait_loop(long k) const
+  {
+    const long target = (k / max_loops + 1) * m_num_threads;
+    std::atomic<long> const& finished = m_finished[k % max_loops];
+    team_spin_until([&] {
+      return finished.load(std::memory_order_acquire) >= target;
+    });
+  }
+
+  void release_slot(long k)
+  {
+    Loop& l = m_loops[k % max_loops];
+    if (l.destroy) {
+      l.destroy(l.body);
+      l.destroy = nullptr;
+    }
+  }
+
+public:
+  explicit Team(int num_threads)
+      : m_posted(0),
+        m_closed(false),
+        m_left(0),
+        m_num_threads(num_threads),
+        m_next(0),
+        m_last_nowait(false),
+        m_last_space{false, 0, 0}
+  {
+    for (long s = 0; s < max_loops; ++s) {
+      m_loops[s].destroy = nullptr;
+      m_finished[s].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  Team(Team const&) = delete;
+  Team& operator=(Team const&) = delete;
+
+  ~Team()
+  {
+    for (long s = 0; s < max_loops; ++s) {
+      release_slot(s);
+    }
+  }
+
+  int num_threads() const { return m_num_threads; }
+
+  //! team the calling thread belongs to, or nullptr outside team regions
+  static Team* current() { return state().team; }
+
+  //! true while the calling thread runs the chunk of a team loop
+  static bool in_loop() { return state().in_loop; }
+
+  /*!
+   * \brief  Posts a loop of size iterations and runs the master's chunk.
+   *
+   *         body is owned by the team if destroy is not null. A nowait
+   *         loop returns after the master's chunk; other loops return once
+   *         every thread is done with them.
+   */
+  void post(void (*run)(void const*, std::ptrdiff_t, std::ptrdiff_t),
+            void (*destroy)(void*),
+            void* body,
+            TeamSpace const& space,
+            bool nowait)
+  {
+    const long k = m_next;
+    if (k >= max_loops) {
+      wait_loop(k - max_loops);
+      release_slot(k);
+    }
+    Loop& l = m_loops[k % max_loops];
+    l.run = run;
+    l.destroy = destroy;
+    l.body = body;
+    l.size = space.size;
+    l.barrier = m_last_nowait && !(space == m_last_space);
+    m_next = k + 1;
+    m_last_nowait = nowait;
+    m_last_space = space;
+    m_posted.store(k + 1, std::memory_order_release);
+
+    run_loop(k, 0);
+    if (!nowait) {
+      wait_loop(k);
+    }
+  }
+
+  //! waits until every thread has finished every posted loop
+  void wait_all()
+  {
+    if (m_next > 0) {
+      wait_loop(m_next - 1);
+    }
+    m_last_nowait = false;
+  }
+
+  //! runs the posted loops on a non-master thread until the team closes
+  void work(int tid)
+  {
+    state().team = this;
+    for (long k = 0;; ++k) {
+      team_spin_until([&] {
+        return m_posted.load(std::memory_order_acquire) > k
+               || m_closed.load(std::memory_order_acquire);
+      });
+      if (m_posted.load(std::memory_order_acquire) <= k) {
+        break;
+      }
+      run_loop(k, tid);
+    }
+    state().team = nullptr;
+    m_left.fetch_add(1, std::memory_order_release);
+  }
+
+  /*!
+   * \brief  Runs body on the master thread, then waits for the team and
+   *         closes it. Returns once every other thread has left work().
+   */
+  template <typename Func>
+  void lead(Func&& body)
+  {
+    state().team = this;
+    body();
+    wait_all();
+    m_closed.store(true, std::memory_order_release);
+    team_spin_until([&] {
+      return m_left.load(std::memory_order_acquire) == m_num_threads - 1;
+    });
+    state().team = nullptr;
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * \brief RAJA::region implementation for a persistent OpenMP thread team.
+ *
+ * Opens an OpenMP parallel region and runs body once, on the master
+ * thread. The forall loops in body that use omp_team_for_exec or
+ * omp_team_for_nowait_exec run on all threads of the region without
+ * starting a new parallel region. Every loop has finished when the region
+ * returns. A team region started inside another one runs body on the
+ * enclosing team.
+ *
+ * \code
+ *
+ * RAJA::region<RAJA::omp_team_region>([&]() {
+ *
+ *   for (int cycle = 0; cycle < num_cycles; ++cycle) {
+ *     RAJA::forall<RAJA::omp_team_for_nowait_exec>(range, ...);
+ *     RAJA::forall<RAJA::omp_team_for_nowait_exec>(range, ...);
+ *     RAJA::forall<RAJA::omp_team_for_exec>(range, ...);
+ *   }
+ *
+ * });
+ *
+ * \endcode
+ */
+template <typename Func>
+RAJA_INLINE void region_impl(const omp_team_region&, Func&& body)
+{
+  if (detail::Team::current()) {
+    body();
+    return;
+  }
+
+  std::atomic<detail::Team*> team{nullptr};
+#pragma omp parallel
+  {
+    const int tid = omp_get_thread_num();
+    if (tid == 0) {
+      detail::Team master_team(omp_get_num_threads());
+      team.store(&master_team, std::memory_order_release);
+      master_team.lead(body);
+    } else {
+      detail::Team* t = nullptr;
+      detail::team_spin_until([&] {
+        return (t = team.load(std::memory_order_acquire)) != nullptr;
+      });
+      t->work(tid);
+    }
+  }
+}
+
+namespace detail
+{
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void team_forall(bool nowait, Iterable&& iter, Func&& loop_body)
+{
+  Team* team = Team::current();
+  if (!team) {
+    forall_impl(omp_parallel_for_exec{},
+                std::forward<Iterable>(iter),
+                std::forward<Func>(loop_body));
+    return;
+  }
+
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using Iterator = decltype(begin(iter));
+  using Body = TeamLoopBody<Iterator, camp::decay<Func>>;
+  auto b = begin(iter);
+  const std::ptrdiff_t dist = distance(b, end(iter));
+
+  // a loop started from inside a team loop runs on the calling thread
+  if (Team::in_loop()) {
+    for (std::ptrdiff_t i = 0; i < dist; ++i) {
+      loop_body(b[i]);
+    }
+    return;
+  }
+
+  const TeamSpace space = team_space(iter, dist);
+  if (nowait) {
+    team->post(&Body::run,
+               &Body::destroy,
+               new Body{b, loop_body},
+               space,
+               true);
+  } else {
+    Body body{b, loop_body};
+    team->post(&Body::run, nullptr, &body, space, false);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief OpenMP team for implementation
+ *
+ * @param omp_team_for_exec OpenMP team tag
+ * @param iter any random access iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * Inside an omp_team_region this forall splits iter into one contiguous
+ * chunk per team thread and returns when all threads are done, without
+ * an OpenMP fork or barrier. Outside a team region it runs like
+ * omp_parallel_for_exec.
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_team_for_exec&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  detail::team_forall(false,
+                      std::forward<Iterable>(iter),
+                      std::forward<Func>(loop_body));
+}
+
+/**
+ * @brief OpenMP team for nowait implementation
+ *
+ * @param omp_team_for_nowait_exec OpenMP team tag
+ * @param iter any random access iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * Like omp_for_nowait_exec, the master returns as soon as its own chunk is
+ * done and the other threads go on to the next loop when they finish
+ * theirs. The loop body is copied, and the indices of iter must stay
+ * valid, until the loop is done. A loop over the same range segment as the
+ * nowait loop before it starts without a barrier, so each thread may
+ * only read values that the previous loop wrote at the same index; any
+ * other loop first waits for the previous one. Results, reducers included,
+ * may be read by the region body only after a following omp_team_for_exec
+ * loop or synchronize<omp_team_synchronize>. RAJA::kernel statements
+ * should use omp_team_for_exec, since their loop bodies refer to data that
+ * only lives until the kernel returns.
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_team_for_nowait_exec&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  detail::team_forall(true,
+                      std::forward<Iterable>(iter),
+                      std::forward<Func>(loop_body));
+}
+
+/*!
+ * \brief Waits for every loop posted to the calling thread's team.
+ *
+ * Does nothing outside a team region.
+ */
+RAJA_INLINE
+void synchronize_impl(const omp_team_synchronize&)
+{
+  detail::Team* team = detail::Team::current();
+  if (team && !detail::Team::in_loop()) {
+    team->wait_all();
+  }
+}
+
+}  // namespace omp
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
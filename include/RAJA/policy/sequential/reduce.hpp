@@ -23,6 +23,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
@@ -51,10 +53,61 @@ public:
 };
 
 
+/*!
+ * \brief  Bin storage for sequential array reducers.
+ *
+ *         Sequential execution needs no privatization, so copies update
+ *         the parent's bins directly.
+ */
+template <typename T, typename Reduce>
+class ReduceSeqArray
+{
+  T* m_bins;
+  Index_type m_size;
+  bool m_owner;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceSeqArray() = delete;
+
+  ReduceSeqArray(Index_type num_bins, T init_val, T RAJA_UNUSED_ARG(identity_))
+      : m_bins(new T[num_bins]), m_size(num_bins), m_owner(true)
+  {
+    std::fill_n(m_bins, m_size, init_val);
+  }
+
+  ReduceSeqArray(ReduceSeqArray const& other)
+      : m_bins(other.m_bins), m_size(other.m_size), m_owner(false)
+  {
+  }
+
+  ~ReduceSeqArray()
+  {
+    if (m_owner) {
+      delete[] m_bins;
+    }
+  }
+
+  void reset(T init_val, T RAJA_UNUSED_ARG(identity_))
+  {
+    std::fill_n(m_bins, m_size, init_val);
+  }
+
+  Index_type size() const { return m_size; }
+
+  T& local(Index_type bin) const { return m_bins[bin]; }
+
+  T get(Index_type bin) const { return m_bins[bin]; }
+
+  void get_all(T* out) const { std::copy_n(m_bins, m_size, out); }
+};
+
 }  // namespace detail
 
 RAJA_DECLARE_ALL_REDUCERS(seq_reduce, detail::ReduceSeq)
 
+RAJA_DECLARE_ALL_ARRAY_REDUCERS(seq_reduce, detail::ReduceSeqArray)
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
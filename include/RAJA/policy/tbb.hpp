@@ -22,10 +22,12 @@
 
 #if defined(RAJA_ENABLE_TBB)
 
+#include "RAJA/policy/tbb/compact.hpp"
 #include "RAJA/policy/tbb/forall.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/tbb/reduce.hpp"
 #include "RAJA/policy/tbb/scan.hpp"
+#include "RAJA/policy/tbb/sort.hpp"
 
 #endif
 
@@ -25,8 +25,11 @@
 
 #if defined(RAJA_ENABLE_TBB)
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 #include <tbb/tbb.h>
 
@@ -82,10 +85,136 @@ public:
    */
   T& local() { return data->local(); }
 };
+
+/*!
+ * \brief  Bin storage for TBB array reducers.
+ *
+ *         Each thread accumulates into its own copy of the bins, held in a
+ *         tbb::enumerable_thread_specific. Reading the result merges the
+ *         thread copies with a parallel_for over blocks of bins.
+ */
+template <typename T, typename Reduce>
+class ReduceTBBArray
+{
+  //! bins are merged in blocks of this many per TBB task
+  static constexpr Index_type merge_block = 2048;
+
+  struct State {
+    State(Index_type num_bins, T init_val, T identity_)
+        : bins(std::vector<T>(num_bins, identity_)),
+          result(num_bins, init_val),
+          identity(identity_),
+          dirty(false)
+    {
+    }
+
+    //! TBB native per-thread containers
+    tbb::enumerable_thread_specific<std::vector<T>> bins;
+    std::vector<T> result;
+    T identity;
+    std::atomic<bool> dirty;
+  };
+
+  std::shared_ptr<State> state;
+  bool owner;
+  //! bins updated by this object, looked up on first use
+  T mutable* my_local;
+
+  void merge() const
+  {
+    State& st = *state;
+    if (!st.dirty.exchange(false)) {
+      return;
+    }
+    using brange = ::tbb::blocked_range<Index_type>;
+    ::tbb::parallel_for(brange(0, static_cast<Index_type>(st.result.size()),
+                               merge_block),
+                        [&](const brange& r) {
+                          for (auto& bins : st.bins) {
+                            for (auto b = r.begin(); b != r.end(); ++b) {
+                              Reduce{}(st.result[b], bins[b]);
+                              bins[b] = st.identity;
+                            }
+                          }
+                        });
+  }
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceTBBArray() = delete;
+
+  ReduceTBBArray(Index_type num_bins, T init_val, T identity_)
+      : state(std::make_shared<State>(num_bins, init_val, identity_)),
+        owner(true),
+        my_local(nullptr)
+  {
+  }
+
+  ReduceTBBArray(ReduceTBBArray const& other)
+      : state(other.state), owner(false), my_local(nullptr)
+  {
+  }
+
+  ~ReduceTBBArray()
+  {
+    if (my_local && !owner) {
+      // mark again in case the result was read while this copy was alive
+      state->dirty.store(true);
+    }
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    State& st = *state;
+    st.identity = identity_;
+    std::fill(st.result.begin(), st.result.end(), init_val);
+    for (auto& bins : st.bins) {
+      std::fill(bins.begin(), bins.end(), identity_);
+    }
+    st.dirty.store(false);
+  }
+
+  Index_type size() const
+  {
+    return static_cast<Index_type>(state->result.size());
+  }
+
+  /*!
+   *  \return reference to the local value of a bin; the parent reducer
+   *          updates the result directly
+   */
+  T& local(Index_type bin) const
+  {
+    if (!my_local) {
+      if (owner) {
+        my_local = state->result.data();
+      } else {
+        my_local = state->bins.local().data();
+        state->dirty.store(true);
+      }
+    }
+    return my_local[bin];
+  }
+
+  T get(Index_type bin) const
+  {
+    merge();
+    return state->result[bin];
+  }
+
+  void get_all(T* out) const
+  {
+    merge();
+    std::copy(state->result.begin(), state->result.end(), out);
+  }
+};
+
 }  // namespace detail
 
 RAJA_DECLARE_ALL_REDUCERS(tbb_reduce, detail::ReduceTBB)
 
+RAJA_DECLARE_ALL_ARRAY_REDUCERS(tbb_reduce, detail::ReduceTBBArray)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_TBB guard
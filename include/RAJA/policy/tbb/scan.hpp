@@ -29,6 +29,8 @@
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/pattern/detail/segmented_scan.hpp"
+
 #include "RAJA/policy/sequential/policy.hpp"
 
 namespace RAJA
@@ -98,6 +100,80 @@ struct scan_adapter_exclusive : scan_adapter<T, InIter, OutIter, Fn> {
     }
   }
 };
+
+/*!
+ * \brief  parallel_scan body for the segmented scans; carries the summary
+ *         of the elements to the left of each range and runs body over the
+ *         range in the final scan.
+ */
+template <typename Value,
+          typename KeyIter,
+          typename ValIter,
+          typename Fn,
+          typename Body>
+struct segmented_adapter {
+  using diff_type = typename std::iterator_traits<KeyIter>::difference_type;
+  using carry_type = ::RAJA::detail::segmented::carry<Value, diff_type>;
+
+  carry_type c;
+  KeyIter keys;
+  ValIter vals;
+  Fn fn;
+  Body const& body;
+
+  segmented_adapter(KeyIter keys_, ValIter vals_, Fn fn_, Body const& body_)
+      : c(::RAJA::detail::segmented::empty_carry<Value, diff_type, Fn>()),
+        keys(keys_),
+        vals(vals_),
+        fn(fn_),
+        body(body_)
+  {
+  }
+
+  segmented_adapter(segmented_adapter& b, tbb::split)
+      : c(::RAJA::detail::segmented::empty_carry<Value, diff_type, Fn>()),
+        keys(b.keys),
+        vals(b.vals),
+        fn(b.fn),
+        body(b.body)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<diff_type>& r, Tag)
+  {
+    // summarize before body runs, as body may overwrite vals
+    const carry_type s = ::RAJA::detail::segmented::summarize<Value>(
+        keys, vals, r.begin(), r.end(), fn);
+    if (Tag::is_final_scan()) body(r.begin(), r.end(), c);
+    c = ::RAJA::detail::segmented::combine(c, s, fn);
+  }
+
+  void reverse_join(const segmented_adapter& a)
+  {
+    c = ::RAJA::detail::segmented::combine(a.c, c, fn);
+  }
+  void assign(const segmented_adapter& b) { c = b.c; }
+};
+
+template <typename Value,
+          typename KeyIter,
+          typename ValIter,
+          typename Fn,
+          typename Body>
+typename std::iterator_traits<KeyIter>::difference_type segmented_scan(
+    KeyIter keys,
+    ValIter vals,
+    typename std::iterator_traits<KeyIter>::difference_type n,
+    Fn fn,
+    Body const& body)
+{
+  using diff_type = typename std::iterator_traits<KeyIter>::difference_type;
+  using Adapter = segmented_adapter<Value, KeyIter, ValIter, Fn, Body>;
+  Adapter adapter{keys, vals, fn, body};
+  tbb::parallel_scan(tbb::blocked_range<diff_type>{0, n}, adapter);
+  return adapter.c.heads;
+}
 }  // namespace detail
 
 /*!
@@ -112,7 +188,7 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive_inplace(
     BinFn f)
 {
   auto adapter = detail::scan_adapter_inclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
+      typename std::iterator_traits<Iter>::value_type,
       Iter,
       Iter,
       BinFn>{begin, begin, f, BinFn::identity()};
@@ -134,7 +210,7 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive_inplace(
     T v)
 {
   auto adapter = detail::scan_adapter_exclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
+      typename std::iterator_traits<Iter>::value_type,
       Iter,
       Iter,
       BinFn>{begin, begin, f, v};
@@ -156,7 +232,7 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive(
     BinFn f)
 {
   auto adapter = detail::scan_adapter_inclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
+      typename std::iterator_traits<Iter>::value_type,
       Iter,
       OutIter,
       BinFn>{begin, out, f, BinFn::identity()};
@@ -183,7 +259,7 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive(
     T v)
 {
   auto adapter = detail::scan_adapter_exclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
+      typename std::iterator_traits<Iter>::value_type,
       Iter,
       OutIter,
       BinFn>{begin, out, f, v};
@@ -192,6 +268,95 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive(
                      adapter);
 }
 
+/*!
+        \brief explicit inclusive segmented scan given key range, values,
+   output, and function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename OutIter,
+          typename BinFn>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+inclusive_segmented(const ExecPolicy&,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    OutIter out,
+                    BinFn f)
+{
+  using Value = typename std::iterator_traits<ValIter>::value_type;
+  using Body = ::RAJA::detail::segmented::
+      inclusive_body<KeyIter, ValIter, OutIter, BinFn>;
+  detail::segmented_scan<Value>(keys_begin,
+                                vals_begin,
+                                std::distance(keys_begin, keys_end),
+                                f,
+                                Body{keys_begin, vals_begin, out, f});
+}
+
+/*!
+        \brief explicit exclusive segmented scan given key range, values,
+   output, function, and initial value
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+exclusive_segmented(const ExecPolicy&,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    OutIter out,
+                    BinFn f,
+                    T v)
+{
+  using Value = typename std::iterator_traits<ValIter>::value_type;
+  using Body = ::RAJA::detail::segmented::
+      exclusive_body<KeyIter, ValIter, OutIter, BinFn, T>;
+  detail::segmented_scan<Value>(keys_begin,
+                                vals_begin,
+                                std::distance(keys_begin, keys_end),
+                                f,
+                                Body{keys_begin, vals_begin, out, f, v});
+}
+
+/*!
+        \brief explicit reduce by key given key range, values, outputs, and
+   function; returns the number of segments
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+typename std::enable_if<
+    type_traits::is_tbb_policy<ExecPolicy>::value,
+    typename std::iterator_traits<KeyIter>::difference_type>::type
+reduce_by_key(const ExecPolicy&,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              ValIter vals_begin,
+              KeyOutIter keys_out,
+              ValOutIter vals_out,
+              BinFn f)
+{
+  using Value = typename std::iterator_traits<ValIter>::value_type;
+  using Body = ::RAJA::detail::segmented::
+      reduce_by_key_body<KeyIter, ValIter, KeyOutIter, ValOutIter, BinFn>;
+  const auto n = std::distance(keys_begin, keys_end);
+  return detail::segmented_scan<Value>(
+      keys_begin,
+      vals_begin,
+      n,
+      f,
+      Body{keys_begin, vals_begin, keys_out, vals_out, f, n});
+}
+
 }  // namespace scan
 
 }  // namespace impl
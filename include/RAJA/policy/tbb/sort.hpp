@@ -0,0 +1,168 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_tbb_HPP
+#define RAJA_sort_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <iterator>
+#include <type_traits>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+//! runs sort blocks as TBB tasks
+struct tbb_blocks {
+  int num_blocks() const { return tbb::this_task_arena::max_concurrency(); }
+
+  template <typename F>
+  void run(int nblocks, F&& f) const
+  {
+    tbb::parallel_for(0, nblocks, [&](int b) { f(b); });
+  }
+};
+
+template <typename Iter, typename Compare>
+void tbb_unstable(Iter begin, Iter end, Compare comp, std::true_type)
+{
+  ::RAJA::detail::sort::sort_keys<false>(
+      tbb_blocks{},
+      begin,
+      end,
+      comp,
+      std::true_type{});
+}
+
+//! general comparators use the TBB native parallel sort
+template <typename Iter, typename Compare>
+void tbb_unstable(Iter begin, Iter end, Compare comp, std::false_type)
+{
+  tbb::parallel_sort(begin, end, comp);
+}
+
+}  // namespace detail
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> unstable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  using T = typename ::std::iterator_traits<Iter>::value_type;
+  detail::tbb_unstable(
+      begin, end, comp, ::RAJA::detail::sort::use_radix<T, Compare>{});
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> stable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  using T = typename ::std::iterator_traits<Iter>::value_type;
+  ::RAJA::detail::sort::sort_keys<true>(
+      detail::tbb_blocks{},
+      begin,
+      end,
+      comp,
+      ::RAJA::detail::sort::use_radix<T, Compare>{});
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> unstable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  using K = typename ::std::iterator_traits<KeyIter>::value_type;
+  ::RAJA::detail::sort::sort_pairs<false>(
+      detail::tbb_blocks{},
+      keys_begin,
+      keys_end,
+      vals_begin,
+      comp,
+      ::RAJA::detail::sort::use_radix<K, Compare>{});
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on
+   keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> stable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  using K = typename ::std::iterator_traits<KeyIter>::value_type;
+  ::RAJA::detail::sort::sort_pairs<true>(
+      detail::tbb_blocks{},
+      keys_begin,
+      keys_end,
+      vals_begin,
+      comp,
+      ::RAJA::detail::sort::use_radix<K, Compare>{});
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
+
+#endif
@@ -0,0 +1,116 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA copy_if, partition and unique
+*          declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_threads_HPP
+#define RAJA_compact_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/compact.hpp"
+
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/sort.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+/*!
+        \brief copy elements of given range satisfying predicate to output;
+   returns the number of elements copied
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename Pred>
+typename std::enable_if<
+    type_traits::is_threads_policy<ExecPolicy>::value,
+    typename ::std::iterator_traits<Iter>::difference_type>::type
+copy_if(const ExecPolicy&, Iter begin, Iter end, OutIter out, Pred pred)
+{
+  return ::RAJA::detail::compact::copy_if(
+      ::RAJA::impl::sort::detail::threads_blocks{},
+      begin,
+      end - begin,
+      out,
+      pred);
+}
+
+/*!
+        \brief copy elements of given range satisfying predicate to the
+   output returned by alloc(count) once count is known; returns count
+*/
+template <typename ExecPolicy, typename Iter, typename Alloc, typename Pred>
+typename std::enable_if<
+    type_traits::is_threads_policy<ExecPolicy>::value,
+    typename ::std::iterator_traits<Iter>::difference_type>::type
+copy_if_alloc(const ExecPolicy&,
+              Iter begin,
+              Iter end,
+              Alloc&& alloc,
+              Pred pred)
+{
+  return ::RAJA::detail::compact::copy_if_alloc(
+      ::RAJA::impl::sort::detail::threads_blocks{},
+      begin,
+      end - begin,
+      std::forward<Alloc>(alloc),
+      pred);
+}
+
+/*!
+        \brief stable partition of given range by predicate; returns the
+   number of elements satisfying it
+*/
+template <typename ExecPolicy, typename Iter, typename Pred>
+typename std::enable_if<
+    type_traits::is_threads_policy<ExecPolicy>::value,
+    typename ::std::iterator_traits<Iter>::difference_type>::type
+partition(const ExecPolicy&, Iter begin, Iter end, Pred pred)
+{
+  return ::RAJA::detail::compact::partition(
+      ::RAJA::impl::sort::detail::threads_blocks{}, begin, end - begin, pred);
+}
+
+/*!
+        \brief remove consecutive equal elements of given range; returns the
+   number of elements kept
+*/
+template <typename ExecPolicy, typename Iter, typename Equal>
+typename std::enable_if<
+    type_traits::is_threads_policy<ExecPolicy>::value,
+    typename ::std::iterator_traits<Iter>::difference_type>::type
+unique(const ExecPolicy&, Iter begin, Iter end, Equal eq)
+{
+  return ::RAJA::detail::compact::unique(
+      ::RAJA::impl::sort::detail::threads_blocks{}, begin, end - begin, eq);
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,149 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for the native thread pool.
+ *
+ *          These methods should work on any platform with C++11 threads.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_threads_HPP
+#define RAJA_forall_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/fault_tolerance.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/pool.hpp"
+#include "RAJA/util/types.hpp"
+
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+namespace detail
+{
+
+//! runs the iterations [lo, hi) of iter with a privatized loop body
+template <typename Iterator, typename Func>
+struct range_body {
+  Iterator b;
+  Func const& loop_body;
+
+  void operator()(std::ptrdiff_t lo, std::ptrdiff_t hi) const
+  {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto body = privatizer.get_priv();
+    for (auto i = lo; i != hi; ++i) {
+      body(b[i]);
+    }
+  }
+};
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_grain(std::ptrdiff_t grain,
+                              Iterable&& iter,
+                              Func const& loop_body)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using Iterator = decltype(begin(iter));
+  auto b = begin(iter);
+  const std::ptrdiff_t dist = distance(b, end(iter));
+  ::RAJA::thread_pool::parallel_for(
+      dist, grain, range_body<Iterator, Func>{b, loop_body});
+}
+
+}  // namespace detail
+
+/**
+ * @brief threads dynamic for implementation
+ *
+ * @param p threads tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * This forall runs the iterable on the RAJA thread pool, splitting it into
+ * subranges of the grain size given in the policy argument that idle threads
+ * steal. A loop started from inside the body of another one runs on the same
+ * threads, so nested loops compose without oversubscription.
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const threads_for_dynamic& p,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  detail::forall_grain(static_cast<std::ptrdiff_t>(p.grain_size),
+                       std::forward<Iterable>(iter),
+                       loop_body);
+}
+
+/**
+ * @brief threads static for implementation
+ *
+ * @param threads_for_static threads tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * This forall splits the iterable into one contiguous subrange per pool
+ * thread, or into subranges of GrainSize iterations if those are larger.
+ * This keeps the fork overhead of well-balanced loops low; threads that
+ * finish early still steal the remaining subranges.
+ */
+template <typename Iterable, typename Func, std::size_t GrainSize>
+RAJA_INLINE void forall_impl(const threads_for_static<GrainSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  const std::ptrdiff_t dist = distance(begin(iter), end(iter));
+  const std::ptrdiff_t nt = ::RAJA::thread_pool::get_num_threads();
+  const std::ptrdiff_t per_thread = (dist + nt - 1) / nt;
+  detail::forall_grain(
+      std::max(per_thread, static_cast<std::ptrdiff_t>(GrainSize)),
+      std::forward<Iterable>(iter),
+      loop_body);
+}
+
+}  // namespace threads
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
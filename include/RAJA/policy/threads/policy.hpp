@@ -0,0 +1,104 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA threads policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_threads_HPP
+#define policy_threads_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include <cstddef>
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policies
+///
+
+/*!
+ * Splits the loop into subranges of at most grain_size iterations that
+ * idle threads steal; a grain_size of zero picks one automatically.
+ */
+struct threads_for_dynamic
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  std::size_t grain_size;
+  threads_for_dynamic(std::size_t grain_size_ = 0) : grain_size(grain_size_)
+  {
+  }
+};
+
+/*!
+ * Splits the loop into one subrange per thread, or into subranges of
+ * GrainSize iterations if that is larger; idle threads still steal.
+ */
+template <std::size_t GrainSize = 1>
+struct threads_for_static
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+using threads_for_exec = threads_for_dynamic;
+
+///
+/// Index set segment iteration policies
+///
+using threads_segit = threads_for_exec;
+
+
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Reduction execution policies
+///
+///////////////////////////////////////////////////////////////////////
+///
+struct threads_reduce
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+}  // namespace threads
+}  // namespace policy
+
+using policy::threads::threads_for_dynamic;
+using policy::threads::threads_for_exec;
+using policy::threads::threads_for_static;
+using policy::threads::threads_reduce;
+using policy::threads::threads_segit;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,442 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the persistent work-stealing thread pool
+ *          used by the RAJA threads back-end.
+ *
+ *          The pool owns one worker thread per hardware thread, less one
+ *          for the thread that submits work, and gives every participant a
+ *          Chase-Lev deque. A parallel loop is a single range task that is
+ *          split in halves on demand: the owner pushes the upper half on
+ *          the bottom of its deque and keeps the lower half, and idle
+ *          threads steal the oldest (largest) halves from the top of other
+ *          deques. A thread that waits for a loop to finish keeps running
+ *          tasks, so a loop started inside another loop's body runs on the
+ *          same threads and nesting never oversubscribes the machine.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_pool_HPP
+#define RAJA_threads_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace thread_pool
+{
+
+namespace detail
+{
+
+using index_type = std::ptrdiff_t;
+
+//! cache line size used to keep per-thread state apart
+constexpr std::size_t cache_line = 64;
+
+/*!
+ * \brief  A parallel loop submitted to the pool. It lives on the stack of
+ *         the thread that submitted it until remaining drops to zero.
+ */
+struct Job {
+  void (*run)(void const*, index_type, index_type);
+  void const* body;
+  index_type grain;
+  std::atomic<index_type> remaining;
+};
+
+//! the iterations [lo, hi) of a job
+struct Task {
+  Job* job;
+  index_type lo;
+  index_type hi;
+};
+
+/*!
+ * \brief  Bounded Chase-Lev work-stealing deque.
+ *
+ *         Only the owning thread calls push and pop, at the bottom; any
+ *         thread may call steal, at the top. A full deque refuses the push
+ *         and the owner simply keeps the work, so no buffer is ever grown.
+ *         Slots are relaxed atomics: a thief may read a slot the owner is
+ *         overwriting, but then its compare-exchange on top fails and the
+ *         torn value is discarded.
+ */
+class Deque
+{
+  static constexpr index_type capacity = index_type(1) << 12;
+
+  struct Slot {
+    std::atomic<Job*> job;
+    std::atomic<index_type> lo;
+    std::atomic<index_type> hi;
+  };
+
+  // top and bottom are padded apart, since thieves only touch top
+  std::atomic<index_type> m_top;
+  char m_pad0[cache_line];
+  std::atomic<index_type> m_bottom;
+  char m_pad1[cache_line];
+  std::unique_ptr<Slot[]> m_slots;
+
+  void store(index_type i, Task const& t)
+  {
+    Slot& s = m_slots[i & (capacity - 1)];
+    s.job.store(t.job, std::memory_order_relaxed);
+    s.lo.store(t.lo, std::memory_order_relaxed);
+    s.hi.store(t.hi, std::memory_order_relaxed);
+  }
+
+  Task load(index_type i) const
+  {
+    Slot const& s = m_slots[i & (capacity - 1)];
+    return Task{s.job.load(std::memory_order_relaxed),
+                s.lo.load(std::memory_order_relaxed),
+                s.hi.load(std::memory_order_relaxed)};
+  }
+
+public:
+  Deque() : m_top(0), m_bottom(0), m_slots(new Slot[capacity]) {}
+
+  bool push(Task const& t)
+  {
+    const index_type b = m_bottom.load(std::memory_order_relaxed);
+    const index_type top = m_top.load(std::memory_order_acquire);
+    if (b - top >= capacity) {
+      return false;
+    }
+    store(b, t);
+    m_bottom.store(b + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(Task& t)
+  {
+    const index_type b = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    index_type top = m_top.load(std::memory_order_relaxed);
+    if (top > b) {
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+      return false;
+    }
+    t = load(b);
+    if (top == b) {
+      // last task: race the thieves for it
+      const bool won =
+          m_top.compare_exchange_strong(top,
+                                        top + 1,
+                                        std::memory_order_seq_cst,
+                                        std::memory_order_relaxed);
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+      return won;
+    }
+    return true;
+  }
+
+  bool steal(Task& t)
+  {
+    index_type top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const index_type b = m_bottom.load(std::memory_order_acquire);
+    if (top >= b) {
+      return false;
+    }
+    t = load(top);
+    return m_top.compare_exchange_strong(top,
+                                         top + 1,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_relaxed);
+  }
+};
+
+//! index of the calling thread in the pool, or -1 outside of it
+inline int& current_thread()
+{
+  static thread_local int id = -1;
+  return id;
+}
+
+/*!
+ * \brief  Number of threads to use: RAJA_NUM_THREADS if it is set to a
+ *         positive number, otherwise the hardware concurrency.
+ */
+inline int default_num_threads()
+{
+  if (const char* env = std::getenv("RAJA_NUM_THREADS")) {
+    const int n = std::atoi(env);
+    if (n > 0) {
+      return n;
+    }
+  }
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Persistent work-stealing thread pool.
+ *
+ *         Thread 0 is whichever thread outside of the pool submits a loop;
+ *         submissions from different outside threads are serialized.
+ *         Threads 1 to num_threads() - 1 are workers that spin briefly and
+ *         then sleep while no loop is running.
+ *
+ ******************************************************************************
+ */
+class Pool
+{
+  //! failed steal rounds before an idle worker rechecks for running loops
+  static constexpr int steal_attempts = 64;
+  //! idle checks before a worker goes to sleep
+  static constexpr int spin_limit = 1 << 12;
+
+  struct Worker {
+    Deque deque;
+    std::uint32_t seed;
+    char pad[cache_line];
+  };
+
+  int m_num_threads;
+  std::unique_ptr<Worker[]> m_workers;
+  std::vector<std::thread> m_threads;
+
+  //! number of loops submitted from outside the pool and not yet finished
+  std::atomic<int> m_active;
+  std::atomic<bool> m_stop;
+  std::mutex m_sleep_mutex;
+  std::condition_variable m_wake;
+  std::mutex m_submit_mutex;
+
+  //! xorshift generator used to pick steal victims
+  static std::uint32_t next_random(std::uint32_t& s)
+  {
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+  }
+
+  bool steal(int me, Task& t)
+  {
+    const int n = m_num_threads;
+    const int start = static_cast<int>(next_random(m_workers[me].seed) % n);
+    for (int k = 0; k < n; ++k) {
+      const int victim = (start + k) % n;
+      if (victim != me && m_workers[victim].deque.steal(t)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool find_task(int me, Task& t)
+  {
+    return m_workers[me].deque.pop(t) || steal(me, t);
+  }
+
+  //! runs a task, leaving halves of it for thieves while it is large
+  void execute(int me, Task t)
+  {
+    Job* const job = t.job;
+    Deque& deque = m_workers[me].deque;
+    while (t.hi - t.lo > job->grain) {
+      const index_type mid = t.lo + (t.hi - t.lo) / 2;
+      if (!deque.push(Task{job, mid, t.hi})) {
+        break;
+      }
+      t.hi = mid;
+    }
+    job->run(job->body, t.lo, t.hi);
+    job->remaining.fetch_sub(t.hi - t.lo, std::memory_order_acq_rel);
+  }
+
+  //! runs tasks until every iteration of job has been executed
+  void wait(int me, Job& job)
+  {
+    Task t;
+    while (job.remaining.load(std::memory_order_acquire) != 0) {
+      if (find_task(me, t)) {
+        execute(me, t);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void worker_loop(int me)
+  {
+    current_thread() = me;
+    Task t;
+    int idle = 0;
+    while (!m_stop.load(std::memory_order_relaxed)) {
+      if (m_active.load(std::memory_order_acquire) > 0) {
+        idle = 0;
+        for (int k = 0; k < steal_attempts; ++k) {
+          if (find_task(me, t)) {
+            execute(me, t);
+            k = 0;
+          }
+        }
+        std::this_thread::yield();
+      } else if (++idle < spin_limit) {
+        std::this_thread::yield();
+      } else {
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+        m_wake.wait(lock, [&] {
+          return m_active.load(std::memory_order_relaxed) > 0
+                 || m_stop.load(std::memory_order_relaxed);
+        });
+        idle = 0;
+      }
+    }
+  }
+
+  void run(int me, Job& job, index_type n)
+  {
+    execute(me, Task{&job, 0, n});
+    wait(me, job);
+  }
+
+public:
+  explicit Pool(int num_threads = default_num_threads())
+      : m_num_threads(std::max(1, num_threads)),
+        m_workers(new Worker[m_num_threads]),
+        m_active(0),
+        m_stop(false)
+  {
+    for (int i = 0; i < m_num_threads; ++i) {
+      m_workers[i].seed = 2654435761u * static_cast<std::uint32_t>(i + 1);
+    }
+    m_threads.reserve(m_num_threads - 1);
+    for (int i = 1; i < m_num_threads; ++i) {
+      m_threads.emplace_back([this, i] { worker_loop(i); });
+    }
+  }
+
+  ~Pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_sleep_mutex);
+      m_stop.store(true);
+    }
+    m_wake.notify_all();
+    for (auto& t : m_threads) {
+      t.join();
+    }
+  }
+
+  Pool(Pool const&) = delete;
+  Pool& operator=(Pool const&) = delete;
+
+  int num_threads() const { return m_num_threads; }
+
+  /*!
+   * \brief  Calls body(lo, hi) over disjoint subranges covering [0, n),
+   *         none longer than grain unless a deque is full, and returns
+   *         once all of them have run. A grain of zero picks one that
+   *         gives each thread about eight subranges.
+   */
+  template <typename Body>
+  void parallel_for(index_type n, index_type grain, Body const& body)
+  {
+    if (n <= 0) {
+      return;
+    }
+    if (grain <= 0) {
+      grain = std::max<index_type>(1, n / (8 * m_num_threads));
+    }
+    if (m_num_threads == 1 || n <= grain) {
+      body(index_type(0), n);
+      return;
+    }
+
+    Job job;
+    job.run = [](void const* b, index_type lo, index_type hi) {
+      (*static_cast<Body const*>(b))(lo, hi);
+    };
+    job.body = &body;
+    job.grain = grain;
+    job.remaining.store(n, std::memory_order_relaxed);
+
+    const int me = current_thread();
+    if (me >= 0) {
+      // nested loop: runs on the threads already working
+      run(me, job, n);
+      return;
+    }
+
+    std::lock_guard<std::mutex> submit(m_submit_mutex);
+    current_thread() = 0;
+    {
+      std::lock_guard<std::mutex> lock(m_sleep_mutex);
+      m_active.fetch_add(1, std::memory_order_release);
+    }
+    m_wake.notify_all();
+    run(0, job, n);
+    m_active.fetch_sub(1, std::memory_order_release);
+    current_thread() = -1;
+  }
+};
+
+}  // namespace detail
+
+//! the process-wide pool, started on first use
+inline detail::Pool& get_pool()
+{
+  static detail::Pool pool;
+  return pool;
+}
+
+//! number of threads in the pool, including the submitting thread
+inline int get_num_threads() { return get_pool().num_threads(); }
+
+/*!
+ * \brief  Index of the calling thread in the pool, in [0, get_num_threads()),
+ *         or -1 if it is not running a pool loop.
+ */
+inline int get_thread_num() { return detail::current_thread(); }
+
+/*!
+ * \brief  Calls body(lo, hi) on the pool over subranges covering [0, n);
+ *         see detail::Pool::parallel_for.
+ */
+template <typename Body>
+RAJA_INLINE void parallel_for(std::ptrdiff_t n,
+                              std::ptrdiff_t grain,
+                              Body const& body)
+{
+  get_pool().parallel_for(n, grain, body);
+}
+
+}  // namespace thread_pool
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
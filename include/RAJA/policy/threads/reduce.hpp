@@ -0,0 +1,406 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates for
+ *          execution on the native thread pool.
+ *
+ *          These methods should work on any platform with C++11 threads.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_reduce_HPP
+#define RAJA_threads_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/pool.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! guards combines from threads that are not running a pool loop
+inline std::mutex& threads_reduce_mutex()
+{
+  static std::mutex m;
+  return m;
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Per-thread partial results for thread pool reducers.
+ *
+ *         One slot is allocated per pool thread and each slot is padded
+ *         to DATA_ALIGN bytes, so threads folding their private reducer
+ *         copies back never share a cache line. A thread only ever writes
+ *         its own slot, which makes the combine lock-free.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class ThreadsReduceSlots
+{
+  struct RAJA_ALIGNED_ATTR(DATA_ALIGN) Slot {
+    T value;
+  };
+
+  Slot* m_slots;
+  int m_num_slots;
+
+public:
+  explicit ThreadsReduceSlots(T const& identity)
+      : m_slots(nullptr), m_num_slots(thread_pool::get_num_threads())
+  {
+    m_slots = allocate_aligned_type<Slot>(DATA_ALIGN,
+                                          m_num_slots * sizeof(Slot));
+    for (int i = 0; i < m_num_slots; ++i) {
+      new (&m_slots[i]) Slot{identity};
+    }
+  }
+
+  ~ThreadsReduceSlots()
+  {
+    for (int i = 0; i < m_num_slots; ++i) {
+      m_slots[i].~Slot();
+    }
+    free_aligned(m_slots);
+  }
+
+  ThreadsReduceSlots(ThreadsReduceSlots const&) = delete;
+  ThreadsReduceSlots& operator=(ThreadsReduceSlots const&) = delete;
+
+  int size() const { return m_num_slots; }
+
+  T& at(int i) const { return m_slots[i].value; }
+
+  /*!
+   *  \return pointer to the calling thread's slot, or nullptr if the
+   *          thread is not running a pool loop.
+   */
+  T* local() const
+  {
+    const int tid = thread_pool::get_thread_num();
+    return (tid >= 0) ? &m_slots[tid].value : nullptr;
+  }
+
+  /*!
+   *  \brief fold every slot into val in thread order and clear the slots.
+   */
+  template <typename Reduce>
+  void fold(T& val, T const& identity) const
+  {
+    for (int i = 0; i < m_num_slots; ++i) {
+      Reduce{}(val, m_slots[i].value);
+      m_slots[i].value = identity;
+    }
+  }
+
+  void reset(T const& identity)
+  {
+    for (int i = 0; i < m_num_slots; ++i) {
+      m_slots[i].value = identity;
+    }
+  }
+};
+
+template <typename T, typename Reduce>
+class ReduceThreads
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceThreads<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceThreads>;
+
+  //! per-thread partial results, owned by the parent reducer
+  ThreadsReduceSlots<T>* slots;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceThreads() = delete;
+
+  ReduceThreads(T init_val, T identity_ = T())
+      : Base(init_val, identity_), slots(new ThreadsReduceSlots<T>(identity_))
+  {
+  }
+
+  ReduceThreads(ReduceThreads const& other) : Base(other), slots(other.slots)
+  {
+  }
+
+  ~ReduceThreads()
+  {
+    if (Base::parent) {
+      if (Base::my_data != Base::identity) {
+        T* slot = slots->local();
+        if (slot) {
+          Reduce()(*slot, Base::my_data);
+        } else {
+          std::lock_guard<std::mutex> lock(threads_reduce_mutex());
+          Reduce()(Base::parent->local(), Base::my_data);
+        }
+      }
+      Base::my_data = Base::identity;
+    } else {
+      delete slots;
+    }
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    slots->reset(identity_);
+  }
+
+  T get_combined() const
+  {
+    if (!Base::parent) {
+      slots->template fold<Reduce>(Base::my_data, Base::identity);
+    }
+    return Base::my_data;
+  }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Bin storage for thread pool array reducers.
+ *
+ *         Each pool thread gets a private, DATA_ALIGN-aligned copy of the
+ *         bins the first time one of its reducer copies is updated; the
+ *         copy is kept and reused by later loops. Reading the result merges
+ *         the private copies in thread order, on the pool over blocks of
+ *         bins.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce>
+class ReduceThreadsArray
+{
+  //! bins are merged in blocks of this many per pool task
+  static constexpr Index_type merge_block = 2048;
+
+  struct PrivateBins {
+    T* bins;
+    bool touched;
+  };
+
+  //! state shared by the parent reducer and all of its copies
+  struct State {
+    State(Index_type num_bins, T init_val, T identity_)
+        : size(num_bins),
+          identity(identity_),
+          result(new T[num_bins]),
+          slots(PrivateBins{nullptr, false})
+    {
+      std::fill_n(result, size, init_val);
+    }
+
+    ~State()
+    {
+      for (int t = 0; t < slots.size(); ++t) {
+        free_bins(slots.at(t).bins);
+      }
+      delete[] result;
+    }
+
+    T* allocate_bins() const
+    {
+      T* bins = allocate_aligned_type<T>(DATA_ALIGN, size * sizeof(T));
+      for (Index_type b = 0; b < size; ++b) {
+        new (&bins[b]) T(identity);
+      }
+      return bins;
+    }
+
+    void free_bins(T* bins) const
+    {
+      if (bins) {
+        for (Index_type b = 0; b < size; ++b) {
+          bins[b].~T();
+        }
+        free_aligned(bins);
+      }
+    }
+
+    Index_type size;
+    T identity;
+    T* result;
+    ThreadsReduceSlots<PrivateBins> slots;
+  };
+
+  State* m_state;
+  bool m_owner;
+  //! bins updated by this object, looked up on first use
+  T mutable* m_local;
+  //! private bins of a copy used outside of a pool loop
+  T mutable* m_own;
+  PrivateBins mutable* m_slot;
+
+  T* acquire() const
+  {
+    if (m_owner) {
+      return m_state->result;
+    }
+    m_slot = m_state->slots.local();
+    if (m_slot) {
+      if (!m_slot->bins) {
+        m_slot->bins = m_state->allocate_bins();
+      }
+      m_slot->touched = true;
+      return m_slot->bins;
+    }
+    m_own = m_state->allocate_bins();
+    return m_own;
+  }
+
+  void merge() const
+  {
+    State& st = *m_state;
+    const int num_slots = st.slots.size();
+
+    bool any = false;
+    for (int t = 0; t < num_slots; ++t) {
+      any = any || st.slots.at(t).touched;
+    }
+    if (!any) {
+      return;
+    }
+
+    const Index_type num_blocks = (st.size + merge_block - 1) / merge_block;
+    thread_pool::parallel_for(
+        num_blocks, 1, [&](std::ptrdiff_t blk0, std::ptrdiff_t blk1) {
+          const Index_type lo = blk0 * merge_block;
+          const Index_type hi = std::min<Index_type>(st.size,
+                                                     blk1 * merge_block);
+          for (int t = 0; t < num_slots; ++t) {
+            PrivateBins& p = st.slots.at(t);
+            if (p.touched) {
+              for (Index_type b = lo; b < hi; ++b) {
+                Reduce{}(st.result[b], p.bins[b]);
+                p.bins[b] = st.identity;
+              }
+            }
+          }
+        });
+
+    for (int t = 0; t < num_slots; ++t) {
+      st.slots.at(t).touched = false;
+    }
+  }
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceThreadsArray() = delete;
+
+  ReduceThreadsArray(Index_type num_bins, T init_val, T identity_)
+      : m_state(new State(num_bins, init_val, identity_)),
+        m_owner(true),
+        m_local(nullptr),
+        m_own(nullptr),
+        m_slot(nullptr)
+  {
+  }
+
+  ReduceThreadsArray(ReduceThreadsArray const& other)
+      : m_state(other.m_state),
+        m_owner(false),
+        m_local(nullptr),
+        m_own(nullptr),
+        m_slot(nullptr)
+  {
+  }
+
+  ~ReduceThreadsArray()
+  {
+    if (m_slot) {
+      // mark again in case the result was read while this copy was alive
+      m_slot->touched = true;
+    }
+    if (m_own) {
+      {
+        std::lock_guard<std::mutex> lock(threads_reduce_mutex());
+        for (Index_type b = 0; b < m_state->size; ++b) {
+          Reduce{}(m_state->result[b], m_own[b]);
+        }
+      }
+      m_state->free_bins(m_own);
+    }
+    if (m_owner) {
+      delete m_state;
+    }
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    State& st = *m_state;
+    st.identity = identity_;
+    std::fill_n(st.result, st.size, init_val);
+    for (int t = 0; t < st.slots.size(); ++t) {
+      PrivateBins& p = st.slots.at(t);
+      if (p.bins) {
+        std::fill_n(p.bins, st.size, identity_);
+      }
+      p.touched = false;
+    }
+  }
+
+  Index_type size() const { return m_state->size; }
+
+  T& local(Index_type bin) const
+  {
+    if (!m_local) {
+      m_local = acquire();
+    }
+    return m_local[bin];
+  }
+
+  T get(Index_type bin) const
+  {
+    merge();
+    return m_state->result[bin];
+  }
+
+  void get_all(T* out) const
+  {
+    merge();
+    std::copy_n(m_state->result, m_state->size, out);
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(threads_reduce, detail::ReduceThreads)
+
+RAJA_DECLARE_ALL_ARRAY_REDUCERS(threads_reduce, detail::ReduceThreadsArray)
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_THREADS guard
+
+#endif  // closing endif for header file include guard
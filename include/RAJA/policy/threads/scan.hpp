@@ -0,0 +1,357 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scan declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_threads_HPP
+#define RAJA_scan_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/segmented_scan.hpp"
+
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/pool.hpp"
+#include "RAJA/policy/threads/sort.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+
+namespace detail
+{
+
+using ::RAJA::detail::sort::block_begin;
+using ::RAJA::impl::sort::detail::threads_blocks;
+
+//! blocks per pool thread, so that stealing can even out the passes
+constexpr int threads_blocks_per_thread = 4;
+
+//! number of scan blocks for n elements
+template <typename DiffType>
+int threads_num_blocks(DiffType n)
+{
+  return static_cast<int>(std::min<DiffType>(
+      n,
+      static_cast<DiffType>(threads_blocks_per_thread
+                            * ::RAJA::thread_pool::get_num_threads())));
+}
+
+/*!
+ * \brief  Reduce-then-scan over [in, in + n) into out on the pool.
+ *
+ *         The range is split into a few blocks per thread. The blocks are
+ *         reduced in parallel, the block totals are scanned in order, and
+ *         the blocks are then scanned in parallel from their offsets. in
+ *         and out may be the same range.
+ */
+template <typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename Value,
+          bool Inclusive>
+void threads_scan(Iter in,
+                  typename ::std::iterator_traits<Iter>::difference_type n,
+                  OutIter out,
+                  BinFn f,
+                  Value init,
+                  std::integral_constant<bool, Inclusive>)
+{
+  using diff_type = typename ::std::iterator_traits<Iter>::difference_type;
+
+  if (n <= 0) {
+    return;
+  }
+  const int nb = threads_num_blocks(n);
+
+  ::std::vector<Value> sums(nb, init);
+  Value* const block_sums = sums.data();
+  threads_blocks{}.run(nb, [=](int b) {
+    const diff_type i1 = block_begin(n, nb, b + 1);
+    Value agg = BinFn::identity();
+    for (diff_type i = block_begin(n, nb, b); i < i1; ++i) {
+      agg = f(agg, *(in + i));
+    }
+    block_sums[b] = agg;
+  });
+
+  Value offset = init;
+  for (int b = 0; b < nb; ++b) {
+    const Value next = f(offset, block_sums[b]);
+    block_sums[b] = offset;
+    offset = next;
+  }
+
+  threads_blocks{}.run(nb, [=](int b) {
+    const diff_type i1 = block_begin(n, nb, b + 1);
+    Value running = block_sums[b];
+    for (diff_type i = block_begin(n, nb, b); i < i1; ++i) {
+      const Value t = *(in + i);
+      if (Inclusive) {
+        running = f(running, t);
+        *(out + i) = running;
+      } else {
+        *(out + i) = running;
+        running = f(running, t);
+      }
+    }
+  });
+}
+
+/*!
+ * \brief  Segmented scan driver over the n elements of keys and vals on
+ *         the pool, using the same blocks as threads_scan. The blocks are
+ *         summarized in parallel, the summaries are combined in order, and
+ *         body then runs over every block with the combined summary of the
+ *         blocks before it. Returns the summary of the whole range.
+ */
+template <typename Value,
+          typename KeyIter,
+          typename ValIter,
+          typename BinFn,
+          typename Body>
+::RAJA::detail::segmented::
+    carry<Value, typename ::std::iterator_traits<KeyIter>::difference_type>
+    threads_segmented(
+        KeyIter keys,
+        ValIter vals,
+        typename ::std::iterator_traits<KeyIter>::difference_type n,
+        BinFn f,
+        Body const& body)
+{
+  using diff_type = typename ::std::iterator_traits<KeyIter>::difference_type;
+  namespace seg = ::RAJA::detail::segmented;
+  using carry_type = seg::carry<Value, diff_type>;
+
+  carry_type total = seg::empty_carry<Value, diff_type, BinFn>();
+  if (n <= 0) {
+    return total;
+  }
+  const int nb = threads_num_blocks(n);
+
+  ::std::vector<carry_type> sums(nb, total);
+  carry_type* const block_sums = sums.data();
+  threads_blocks{}.run(nb, [=](int b) {
+    block_sums[b] = seg::summarize<Value>(keys,
+                                          vals,
+                                          block_begin(n, nb, b),
+                                          block_begin(n, nb, b + 1),
+                                          f);
+  });
+
+  for (int b = 0; b < nb; ++b) {
+    const carry_type next = seg::combine(total, block_sums[b], f);
+    block_sums[b] = total;
+    total = next;
+  }
+
+  threads_blocks{}.run(nb, [=, &body](int b) {
+    body(block_begin(n, nb, b),
+         block_begin(n, nb, b + 1),
+         block_sums[b]);
+  });
+
+  return total;
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename BinFn>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> inclusive_inplace(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  detail::threads_scan(begin,
+                       end - begin,
+                       begin,
+                       f,
+                       Value(BinFn::identity()),
+                       std::true_type{});
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename BinFn, typename ValueT>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> exclusive_inplace(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  detail::threads_scan(
+      begin, end - begin, begin, f, Value(v), std::false_type{});
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename OutIter, typename BinFn>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> inclusive(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  detail::threads_scan(
+      begin, end - begin, out, f, Value(BinFn::identity()), std::true_type{});
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> exclusive(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  detail::threads_scan(begin, end - begin, out, f, Value(v), std::false_type{});
+}
+
+/*!
+        \brief explicit inclusive segmented scan given key range, values,
+   output, and function
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename OutIter,
+          typename BinFn>
+concepts::enable_if<type_traits::is_threads_policy<Policy>>
+inclusive_segmented(const Policy&,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    OutIter out,
+                    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<ValIter>::value_type;
+  using Body = ::RAJA::detail::segmented::
+      inclusive_body<KeyIter, ValIter, OutIter, BinFn>;
+  detail::threads_segmented<Value>(keys_begin,
+                                   vals_begin,
+                                   keys_end - keys_begin,
+                                   f,
+                                   Body{keys_begin, vals_begin, out, f});
+}
+
+/*!
+        \brief explicit exclusive segmented scan given key range, values,
+   output, function, and initial value
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_threads_policy<Policy>>
+exclusive_segmented(const Policy&,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    OutIter out,
+                    BinFn f,
+                    T v)
+{
+  using Value = typename ::std::iterator_traits<ValIter>::value_type;
+  using Body = ::RAJA::detail::segmented::
+      exclusive_body<KeyIter, ValIter, OutIter, BinFn, T>;
+  detail::threads_segmented<Value>(keys_begin,
+                                   vals_begin,
+                                   keys_end - keys_begin,
+                                   f,
+                                   Body{keys_begin, vals_begin, out, f, v});
+}
+
+/*!
+        \brief explicit reduce by key given key range, values, outputs, and
+   function; returns the number of segments
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+typename std::enable_if<
+    type_traits::is_threads_policy<Policy>::value,
+    typename ::std::iterator_traits<KeyIter>::difference_type>::type
+reduce_by_key(const Policy&,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              ValIter vals_begin,
+              KeyOutIter keys_out,
+              ValOutIter vals_out,
+              BinFn f)
+{
+  using Value = typename ::std::iterator_traits<ValIter>::value_type;
+  using Body = ::RAJA::detail::segmented::
+      reduce_by_key_body<KeyIter, ValIter, KeyOutIter, ValOutIter, BinFn>;
+  const auto n = keys_end - keys_begin;
+  return detail::threads_segmented<Value>(
+             keys_begin,
+             vals_begin,
+             n,
+             f,
+             Body{keys_begin, vals_begin, keys_out, vals_out, f, n})
+      .heads;
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif
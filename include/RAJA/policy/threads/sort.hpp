@@ -0,0 +1,159 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_threads_HPP
+#define RAJA_sort_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/pool.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+//! runs sort blocks as thread pool tasks
+struct threads_blocks {
+  int num_blocks() const { return ::RAJA::thread_pool::get_num_threads(); }
+
+  template <typename F>
+  void run(int nblocks, F&& f) const
+  {
+    ::RAJA::thread_pool::parallel_for(
+        nblocks, 1, [&](std::ptrdiff_t b0, std::ptrdiff_t b1) {
+          for (std::ptrdiff_t b = b0; b < b1; ++b) {
+            f(static_cast<int>(b));
+          }
+        });
+  }
+};
+
+}  // namespace detail
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>> unstable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  using T = typename ::std::iterator_traits<Iter>::value_type;
+  ::RAJA::detail::sort::sort_keys<false>(
+      detail::threads_blocks{},
+      begin,
+      end,
+      comp,
+      ::RAJA::detail::sort::use_radix<T, Compare>{});
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>> stable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  using T = typename ::std::iterator_traits<Iter>::value_type;
+  ::RAJA::detail::sort::sort_keys<true>(
+      detail::threads_blocks{},
+      begin,
+      end,
+      comp,
+      ::RAJA::detail::sort::use_radix<T, Compare>{});
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>> unstable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  using K = typename ::std::iterator_traits<KeyIter>::value_type;
+  ::RAJA::detail::sort::sort_pairs<false>(
+      detail::threads_blocks{},
+      keys_begin,
+      keys_end,
+      vals_begin,
+      comp,
+      ::RAJA::detail::sort::use_radix<K, Compare>{});
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on
+   keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>> stable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  using K = typename ::std::iterator_traits<KeyIter>::value_type;
+  ::RAJA::detail::sort::sort_pairs<true>(
+      detail::threads_blocks{},
+      keys_begin,
+      keys_end,
+      vals_begin,
+      comp,
+      ::RAJA::detail::sort::use_radix<K, Compare>{});
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
+
+#endif
@@ -0,0 +1,397 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining array-of-structs-of-arrays (AoSoA)
+ *          storage and views for multi-field data
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_AoSoA_HPP
+#define RAJA_util_AoSoA_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdio>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! rounds n up to a multiple of a
+RAJA_HOST_DEVICE RAJA_INLINE constexpr size_t aosoa_round_up(size_t n,
+                                                             size_t a)
+{
+  return (n + a - 1) / a * a;
+}
+
+/*!
+ * Returns the byte offset of field number field inside a block of Width
+ * elements that starts at offset, with each field aligned for its type.
+ * Passing the number of fields gives the end of the last field.
+ */
+template <camp::idx_t Width>
+RAJA_HOST_DEVICE constexpr size_t aosoa_field_offset(camp::idx_t,
+                                                     size_t offset)
+{
+  return offset;
+}
+
+template <camp::idx_t Width, typename T, typename... Rest>
+RAJA_HOST_DEVICE constexpr size_t aosoa_field_offset(camp::idx_t field,
+                                                     size_t offset)
+{
+  return field == 0
+             ? aosoa_round_up(offset, alignof(T))
+             : aosoa_field_offset<Width, Rest...>(
+                   field - 1,
+                   aosoa_round_up(offset, alignof(T)) + Width * sizeof(T));
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Layout of one field of AoSoA data, mapping a (block, lane) pair to
+ * block * block_stride + lane.
+ *
+ * The lane has a compile time stride of one and a compile time extent of
+ * Width, so a loop over the lanes of a block reads Width contiguous values
+ * and vectorizes without a runtime stride check.
+ */
+template <camp::idx_t Width, typename IdxLin = Index_type>
+struct AoSoALayout {
+  using IndexLinear = IdxLin;
+
+  static constexpr size_t n_dims = 2;
+
+  //! number of lanes in a block
+  static constexpr IdxLin width = Width;
+
+  static_assert(Width > 0, "AoSoA width must be positive");
+
+  IdxLin num_blocks;
+  IdxLin block_stride;
+
+  /*!
+   * Default constructor with zero blocks.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr AoSoALayout()
+      : num_blocks{0}, block_stride{Width}
+  {
+  }
+
+  /*!
+   * Construct a layout of num_blocks blocks, with block_stride elements
+   * from the start of one block of this field to the start of the next.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr AoSoALayout(IdxLin nblocks,
+                                                    IdxLin stride = Width)
+      : num_blocks{nblocks}, block_stride{stride}
+  {
+  }
+
+  /*!
+   * Methods to performs bounds checking in layout objects
+   */
+  template <typename Idx>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(int dim,
+                                                     Idx idx,
+                                                     IdxLin extent) const
+  {
+    printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+           dim,
+           static_cast<long int>(idx),
+           static_cast<long int>(extent - 1));
+    RAJA_ABORT_OR_THROW("Out of bounds error \n");
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(IdxLin block,
+                                                IdxLin lane) const
+  {
+    if (!(0 <= block && block < num_blocks)) {
+      BoundsCheckError(0, block, num_blocks);
+    }
+    if (!(0 <= lane && lane < width)) {
+      BoundsCheckError(1, lane, width);
+    }
+  }
+
+  /*!
+   * Computes a linear space index from a block and a lane.
+   *
+   * @param block  Block of Width elements
+   * @param lane  Element inside the block
+   * @return Linear space index.
+   */
+  template <typename Block, typename Lane>
+  RAJA_INLINE RAJA_HOST_DEVICE RAJA_BOUNDS_CHECK_constexpr IdxLin operator()(
+      Block block,
+      Lane lane) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck(IdxLin(block), IdxLin(lane));
+#endif
+    return IdxLin(block) * block_stride + IdxLin(lane);
+  }
+
+  /*!
+   * Given a linear-space index of an element of this field, compute its
+   * block and lane.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param block  Assigned the block of the element
+   * @param lane  Assigned the lane of the element
+   */
+  template <typename Block, typename Lane>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Block &&block,
+                                              Lane &&lane) const
+  {
+    block = static_cast<camp::decay<Block>>(linear_index / block_stride);
+    lane = static_cast<camp::decay<Lane>>(linear_index % block_stride);
+  }
+
+  /*!
+   * Computes the number of values spanned by this field, including the
+   * other fields stored between its blocks.
+   *
+   * @return Total size spanned by indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return num_blocks * block_stride;
+  }
+};
+
+template <camp::idx_t Width, typename IdxLin>
+constexpr size_t AoSoALayout<Width, IdxLin>::n_dims;
+template <camp::idx_t Width, typename IdxLin>
+constexpr IdxLin AoSoALayout<Width, IdxLin>::width;
+
+/*!
+ * @brief A non-owning view of array-of-structs-of-arrays data.
+ *
+ * Elements are stored in blocks of Width. Each block holds Width values of
+ * the first field, then Width values of the second field, and so on, so
+ * the fields of an element share a few cache lines and pages like an array
+ * of structs, while each field of a block is a contiguous array like a
+ * struct of arrays. The last block is padded to Width elements, and each
+ * block is padded to a multiple of RAJA::DATA_ALIGN bytes.
+ *
+ * Fields are selected by their position in Fields. get<F>(i) gives field F
+ * of element i, and field<F>() gives a View of field F indexed by
+ * (block, lane). Loops over the lanes of a block make unit-stride vector
+ * loads and stores, e.g. with the kernel policy
+ *
+ *     using Pol = KernelPolicy<
+ *         statement::For<0, loop_exec,       // blocks
+ *           statement::For<1, simd_exec,     // lanes
+ *             statement::Lambda<0>>>>;
+ *
+ *     AoSoAView<8, double, double, int> zones(ptr, nzones);
+ *     auto e = zones.field<0>();
+ *     auto p = zones.field<1>();
+ *     kernel<Pol>(make_tuple(RangeSegment(0, zones.num_blocks()),
+ *                            RangeSegment(0, 8)),
+ *                 [=](Index_type b, Index_type l) { e(b, l) += p(b, l); });
+ *
+ * The lanes of the last block beyond size() are allocated, so loops may
+ * run over whole blocks. Fields should be trivial types; they are not
+ * constructed or destroyed.
+ */
+template <camp::idx_t Width, typename... Fields>
+class AoSoAView
+{
+public:
+  //! number of elements in each block
+  static constexpr camp::idx_t width = Width;
+
+  static constexpr size_t n_fields = sizeof...(Fields);
+
+  static_assert(Width > 0, "AoSoA width must be positive");
+  static_assert(sizeof...(Fields) > 0, "AoSoA must have at least one field");
+
+  /*!
+   * Bytes from the start of one block to the start of the next, padded to
+   * a multiple of RAJA::DATA_ALIGN so every block starts on a vector
+   * boundary and each field has the same alignment in every block.
+   */
+  static constexpr size_t block_bytes = detail::aosoa_round_up(
+      detail::aosoa_field_offset<Width, Fields...>(sizeof...(Fields), 0),
+      RAJA::max<size_t>(size_t(DATA_ALIGN), sizeof(Fields)...));
+
+  //! type of field F
+  template <camp::idx_t F>
+  using field_type = camp::at_v<camp::list<Fields...>, F>;
+
+  //! View of field F, indexed by (block, lane)
+  template <camp::idx_t F>
+  using field_view = View<field_type<F>, AoSoALayout<Width>>;
+
+  /*!
+   * Returns the number of bytes to allocate for size elements.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr size_t bytes(Index_type size)
+  {
+    return static_cast<size_t>((size + Width - 1) / Width) * block_bytes;
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr AoSoAView()
+      : m_data{nullptr}, m_size{0}
+  {
+  }
+
+  /*!
+   * Construct a view of size elements, over bytes(size) bytes at data_ptr.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE AoSoAView(void *data_ptr, Index_type size)
+      : m_data{static_cast<char *>(data_ptr)}, m_size{size}
+  {
+  }
+
+  RAJA_INLINE void set_data(void *data_ptr)
+  {
+    m_data = static_cast<char *>(data_ptr);
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE void *data() const { return m_data; }
+
+  //! number of elements
+  RAJA_INLINE RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  //! number of blocks, including the padded last block
+  RAJA_INLINE RAJA_HOST_DEVICE Index_type num_blocks() const
+  {
+    return (m_size + Width - 1) / Width;
+  }
+
+  /*!
+   * Returns a pointer to the Width contiguous values of field F in block b.
+   */
+  template <camp::idx_t F>
+  RAJA_INLINE RAJA_HOST_DEVICE field_type<F> *block(Index_type b) const
+  {
+    return reinterpret_cast<field_type<F> *>(
+        m_data + b * block_bytes +
+        detail::aosoa_field_offset<Width, Fields...>(F, 0));
+  }
+
+  /*!
+   * Returns field F of element i.
+   */
+  template <camp::idx_t F>
+  RAJA_INLINE RAJA_HOST_DEVICE field_type<F> &get(Index_type i) const
+  {
+    return block<F>(i / Width)[i % Width];
+  }
+
+  /*!
+   * Returns a View of field F, indexed by (block, lane).
+   */
+  template <camp::idx_t F>
+  RAJA_INLINE field_view<F> field() const
+  {
+    static_assert(block_bytes % sizeof(field_type<F>) == 0,
+                  "AoSoA block size must be a multiple of the field size, "
+                  "use a larger width");
+    return field_view<F>(block<F>(0),
+                         AoSoALayout<Width>(
+                             num_blocks(),
+                             Index_type(block_bytes / sizeof(field_type<F>))));
+  }
+
+private:
+  char *m_data;
+  Index_type m_size;
+};
+
+template <camp::idx_t Width, typename... Fields>
+constexpr camp::idx_t AoSoAView<Width, Fields...>::width;
+template <camp::idx_t Width, typename... Fields>
+constexpr size_t AoSoAView<Width, Fields...>::n_fields;
+template <camp::idx_t Width, typename... Fields>
+constexpr size_t AoSoAView<Width, Fields...>::block_bytes;
+
+/*!
+ * @brief Host allocated array-of-structs-of-arrays storage.
+ *
+ * Owns bytes(size) bytes aligned to RAJA::DATA_ALIGN, and gives access to
+ * them as an AoSoAView. The storage may be moved but not copied; capture a
+ * view() or field<F>() in kernel bodies instead of the container.
+ *
+ *     AoSoA<8, double, double, int> zones(nzones);
+ *     zones.get<2>(17) = 1;
+ */
+template <camp::idx_t Width, typename... Fields>
+class AoSoA : public AoSoAView<Width, Fields...>
+{
+  using Base = AoSoAView<Width, Fields...>;
+
+public:
+  AoSoA() = default;
+
+  explicit AoSoA(Index_type size)
+      : Base(allocate_aligned(alignment(), Base::bytes(size)), size)
+  {
+  }
+
+  AoSoA(AoSoA const &) = delete;
+  AoSoA &operator=(AoSoA const &) = delete;
+
+  AoSoA(AoSoA &&other) : Base(other) { other.release(); }
+
+  AoSoA &operator=(AoSoA &&other)
+  {
+    if (this != &other) {
+      deallocate();
+      Base::operator=(other);
+      other.release();
+    }
+    return *this;
+  }
+
+  ~AoSoA() { deallocate(); }
+
+  //! a non-owning view of the storage
+  RAJA_INLINE Base view() const { return *this; }
+
+private:
+  static constexpr size_t alignment()
+  {
+    return RAJA::max<size_t>(size_t(DATA_ALIGN), alignof(Fields)...);
+  }
+
+  void release() { Base::operator=(Base()); }
+
+  void deallocate()
+  {
+    if (this->data() != nullptr) {
+      free_aligned(this->data());
+    }
+  }
+};
+
+}  // namespace RAJA
+
+#endif  // RAJA_util_AoSoA_HPP
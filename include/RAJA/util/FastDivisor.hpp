@@ -0,0 +1,126 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining division by a run-time invariant
+ *          divisor with a precomputed reciprocal
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_FastDivisor_HPP
+#define RAJA_util_FastDivisor_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+
+#if defined(RAJA_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! high 64 bits of the 128-bit product of a and b
+RAJA_HOST_DEVICE RAJA_INLINE uint64_t mulhi64(uint64_t a, uint64_t b)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return __umul64hi(a, b);
+#elif defined(__SIZEOF_INT128__)
+  __extension__ using uint128 = unsigned __int128;
+  return static_cast<uint64_t>((static_cast<uint128>(a) * b) >> 64);
+#elif defined(RAJA_COMPILER_MSVC) && defined(_M_X64)
+  return __umulh(a, b);
+#else
+  const uint64_t a_lo = a & 0xffffffffu;
+  const uint64_t a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xffffffffu;
+  const uint64_t b_hi = b >> 32;
+  const uint64_t mid = (a_lo * b_lo >> 32) + (a_hi * b_lo & 0xffffffffu)
+                       + a_lo * b_hi;
+  return a_hi * b_hi + (a_hi * b_lo >> 32) + (mid >> 32);
+#endif
+}
+
+/*!
+ * Divides by a fixed divisor with a multiply and a shift.
+ *
+ * For a divisor d with 2^l >= d, the reciprocal m = ceil(2^(63+l) / d)
+ * gives floor(n / d) = floor(m * n / 2^(63+l)) for every n < 2^63
+ * (Granlund and Montgomery, "Division by Invariant Integers using
+ * Multiplication", 1994). m is computed once, when the divisor is
+ * constructed, and fits in 64 bits.
+ *
+ * The divisor must be in [1, 2^63), and so must every dividend.
+ */
+struct FastDivisor {
+
+  uint64_t magic;
+  int shift;
+
+  /*!
+   * Default constructor divides by one.
+   */
+  RAJA_HOST_DEVICE constexpr FastDivisor()
+      : magic(uint64_t(1) << 63), shift(0)
+  {
+  }
+
+  /*!
+   * Construct a divisor by d.
+   */
+  RAJA_HOST_DEVICE constexpr FastDivisor(uint64_t d)
+      : magic(computeMagic((uint64_t(1) << 63) / d,
+                           (uint64_t(1) << 63) % d,
+                           d,
+                           ceilLog2(d))),
+        shift(ceilLog2(d))
+  {
+  }
+
+  //! returns n / d
+  RAJA_HOST_DEVICE RAJA_INLINE uint64_t divide(uint64_t n) const
+  {
+    return mulhi64(magic, n << 1) >> shift;
+  }
+
+private:
+  //! smallest l with 2^l >= d
+  RAJA_HOST_DEVICE static constexpr int ceilLog2(uint64_t d, int l = 0)
+  {
+    return (uint64_t(1) << l) >= d ? l : ceilLog2(d, l + 1);
+  }
+
+  //! ceil(2^(63+k) / d), given q and r for 2^63 / d, one bit per step
+  RAJA_HOST_DEVICE static constexpr uint64_t computeMagic(uint64_t q,
+                                                         uint64_t r,
+                                                         uint64_t d,
+                                                         int k)
+  {
+    return k == 0 ? q + (r != 0 ? 1 : 0)
+                  : computeMagic(2 * q + (2 * r >= d ? 1 : 0),
+                                 2 * r >= d ? 2 * r - d : 2 * r,
+                                 d,
+                                 k - 1);
+  }
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // RAJA_util_FastDivisor_HPP
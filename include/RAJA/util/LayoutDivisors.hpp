@@ -0,0 +1,171 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining LayoutDivisors, which converts linear
+ *          indices of a layout to indices without integer divides
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_LayoutDivisors_HPP
+#define RAJA_util_LayoutDivisors_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/FastDivisor.hpp"
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/OffsetLayout.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Range, typename IdxLin>
+struct LayoutDivisors_impl;
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+struct LayoutDivisors_impl<camp::idx_seq<RangeInts...>, IdxLin> {
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+
+  FastDivisor div_strides[n_dims];
+  FastDivisor div_mods[n_dims];
+  IdxLin mods[n_dims];
+  IdxLin offsets[n_dims] = {0};
+
+  /*!
+   * Reciprocals of the strides and sizes of layout.
+   */
+  template <typename LIdxLin, ptrdiff_t StrideOneDim>
+  RAJA_INLINE RAJA_HOST_DEVICE LayoutDivisors_impl(
+      LayoutBase_impl<camp::idx_seq<RangeInts...>, LIdxLin, StrideOneDim> const
+          &layout)
+      : div_strides{FastDivisor(
+            static_cast<uint64_t>(layout.inv_strides[RangeInts]))...},
+        div_mods{
+            FastDivisor(static_cast<uint64_t>(layout.inv_mods[RangeInts]))...},
+        mods{static_cast<IdxLin>(layout.inv_mods[RangeInts])...}
+  {
+  }
+
+  /*!
+   * Reciprocals of the strides and sizes of an offset layout, with its
+   * offsets added to the indices.
+   */
+  template <typename LIdxLin>
+  RAJA_INLINE RAJA_HOST_DEVICE LayoutDivisors_impl(
+      internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>, LIdxLin> const
+          &layout)
+      : LayoutDivisors_impl(layout.base_)
+  {
+    for (size_t i = 0; i < n_dims; ++i) {
+      offsets[i] = static_cast<IdxLin>(layout.offsets[i]);
+    }
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by the layout, as the layout's toIndices does.
+   *
+   * Each index is (linear_index / stride) % size. The divisions multiply by
+   * the reciprocals, so this operation requires no integer divide
+   * instructions. linear_index must not be negative.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of the layout.
+   */
+  template <typename Lin, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(Lin linear_index,
+                                              Indices &&... indices) const
+  {
+    static_assert(n_dims == sizeof...(Indices),
+                  "number of dimensions must match");
+    const uint64_t lin = static_cast<uint64_t>(stripIndexType(linear_index));
+    camp::sink((indices = static_cast<camp::decay<Indices>>(
+                    toIndex(RangeInts, lin) + offsets[RangeInts]))...);
+  }
+
+  /*!
+   * Computes the index of dimension dim from a linear-space index, before
+   * the offset is added.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin toIndex(camp::idx_t dim,
+                                              uint64_t linear_index) const
+  {
+    const uint64_t quot = div_strides[dim].divide(linear_index);
+    return static_cast<IdxLin>(quot - div_mods[dim].divide(quot)
+                                          * static_cast<uint64_t>(mods[dim]));
+  }
+};
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+constexpr size_t
+    LayoutDivisors_impl<camp::idx_seq<RangeInts...>, IdxLin>::n_dims;
+
+}  // namespace detail
+
+/*!
+ * @brief Reciprocals of the strides and sizes of a layout, for toIndices
+ * without integer divides.
+ *
+ * A layout's toIndices makes two integer divides per dimension. Loops that
+ * convert many linear indices with the same layout can build a
+ * LayoutDivisors from it once, outside the loop, and call its toIndices
+ * instead, which multiplies by the reciprocals:
+ *
+ *     const auto div = make_layout_divisors(layout);
+ *     forall<loop_exec>(RangeSegment(0, layout.size()), [=](Index_type lin) {
+ *       Index_type i, j, k;
+ *       div.toIndices(lin, i, j, k);
+ *     });
+ *
+ * Layout, TypedLayout, permuted layouts, OffsetLayout and TypedOffsetLayout
+ * are supported. The layouts themselves do not hold the reciprocals, so
+ * building them is only paid for where they are used.
+ */
+template <size_t n_dims, typename IdxLin = Index_type>
+using LayoutDivisors =
+    detail::LayoutDivisors_impl<camp::make_idx_seq_t<n_dims>, IdxLin>;
+
+/*!
+ * Returns the LayoutDivisors of a layout.
+ */
+template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
+RAJA_INLINE RAJA_HOST_DEVICE LayoutDivisors<sizeof...(RangeInts), IdxLin>
+make_layout_divisors(
+    detail::LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim>
+        const &layout)
+{
+  return LayoutDivisors<sizeof...(RangeInts), IdxLin>(layout);
+}
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+RAJA_INLINE RAJA_HOST_DEVICE LayoutDivisors<sizeof...(RangeInts), IdxLin>
+make_layout_divisors(
+    internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> const
+        &layout)
+{
+  return LayoutDivisors<sizeof...(RangeInts), IdxLin>(layout);
+}
+
+}  // namespace RAJA
+
+#endif  // RAJA_util_LayoutDivisors_HPP
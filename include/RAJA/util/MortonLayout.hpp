@@ -0,0 +1,458 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining MortonLayout, a 2 or 3-dimensional
+ *          index calculator that orders data along a Z-order curve
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_MortonLayout_HPP
+#define RAJA_util_MortonLayout_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/Layout.hpp"
+
+//
+// Use the BMI2 bit deposit and extract instructions on the host when the
+// compiler targets them, e.g. with -mbmi2 or -march=haswell.
+//
+#if defined(__BMI2__) && !defined(__CUDA_ARCH__) && \
+    !defined(__HIP_DEVICE_COMPILE__)
+#include <immintrin.h>
+#define RAJA_MORTON_USE_PDEP
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! one step of spreading the bits of x apart
+RAJA_HOST_DEVICE RAJA_INLINE constexpr uint64_t morton_spread_step(
+    uint64_t x,
+    int shift,
+    uint64_t mask)
+{
+  return (x | (x << shift)) & mask;
+}
+
+//! one step of gathering the spread bits of x together
+RAJA_HOST_DEVICE RAJA_INLINE constexpr uint64_t morton_compact_step(
+    uint64_t x,
+    int shift,
+    uint64_t mask)
+{
+  return (x ^ (x >> shift)) & mask;
+}
+
+//! moves bit t of the low 32 bits of x to bit 2t
+RAJA_HOST_DEVICE RAJA_INLINE constexpr uint64_t morton_spread2(uint64_t x)
+{
+  return morton_spread_step(
+      morton_spread_step(
+          morton_spread_step(
+              morton_spread_step(
+                  morton_spread_step(x & 0xffffffffull,
+                                     16,
+                                     0x0000ffff0000ffffull),
+                  8,
+                  0x00ff00ff00ff00ffull),
+              4,
+              0x0f0f0f0f0f0f0f0full),
+          2,
+          0x3333333333333333ull),
+      1,
+      0x5555555555555555ull);
+}
+
+//! moves bit 2t of x to bit t
+RAJA_HOST_DEVICE RAJA_INLINE constexpr uint64_t morton_compact2(uint64_t x)
+{
+  return morton_compact_step(
+      morton_compact_step(
+          morton_compact_step(
+              morton_compact_step(
+                  morton_compact_step(x & 0x5555555555555555ull,
+                                      1,
+                                      0x3333333333333333ull),
+                  2,
+                  0x0f0f0f0f0f0f0f0full),
+              4,
+              0x00ff00ff00ff00ffull),
+          8,
+          0x0000ffff0000ffffull),
+      16,
+      0x00000000ffffffffull);
+}
+
+//! moves bit t of the low 21 bits of x to bit 3t
+RAJA_HOST_DEVICE RAJA_INLINE constexpr uint64_t morton_spread3(uint64_t x)
+{
+  return morton_spread_step(
+      morton_spread_step(
+          morton_spread_step(
+              morton_spread_step(
+                  morton_spread_step(x & 0x1fffffull,
+                                     32,
+                                     0x001f00000000ffffull),
+                  16,
+                  0x001f0000ff0000ffull),
+              8,
+              0x100f00f00f00f00full),
+          4,
+          0x10c30c30c30c30c3ull),
+      2,
+      0x1249249249249249ull);
+}
+
+//! moves bit 3t of x to bit t
+RAJA_HOST_DEVICE RAJA_INLINE constexpr uint64_t morton_compact3(uint64_t x)
+{
+  return morton_compact_step(
+      morton_compact_step(
+          morton_compact_step(
+              morton_compact_step(
+                  morton_compact_step(x & 0x1249249249249249ull,
+                                      2,
+                                      0x10c30c30c30c30c3ull),
+                  4,
+                  0x100f00f00f00f00full),
+              8,
+              0x001f0000ff0000ffull),
+          16,
+          0x001f00000000ffffull),
+      32,
+      0x00000000001fffffull);
+}
+
+/*!
+ * Tables of the spread bits of each byte, filled at compile time.
+ */
+template <typename Bytes>
+struct MortonTable;
+
+template <camp::idx_t... Bytes>
+struct MortonTable<camp::idx_seq<Bytes...>> {
+  static constexpr uint32_t spread2[sizeof...(Bytes)] = {
+      static_cast<uint32_t>(morton_spread2(Bytes))...};
+  static constexpr uint32_t spread3[sizeof...(Bytes)] = {
+      static_cast<uint32_t>(morton_spread3(Bytes))...};
+};
+
+template <camp::idx_t... Bytes>
+constexpr uint32_t
+    MortonTable<camp::idx_seq<Bytes...>>::spread2[sizeof...(Bytes)];
+template <camp::idx_t... Bytes>
+constexpr uint32_t
+    MortonTable<camp::idx_seq<Bytes...>>::spread3[sizeof...(Bytes)];
+
+using morton_table = MortonTable<camp::make_idx_seq_t<256>>;
+
+/*!
+ * Spreads the bits of a coordinate to every n_dims-th bit, and gathers
+ * them back. Uses the byte tables on the host and bit twiddling on
+ * devices.
+ */
+template <size_t n_dims>
+struct MortonCode;
+
+template <>
+struct MortonCode<2> {
+  static constexpr int max_bits = 31;
+
+  RAJA_HOST_DEVICE static RAJA_INLINE uint64_t spread(uint64_t x)
+  {
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+    return morton_spread2(x);
+#else
+    return uint64_t(morton_table::spread2[x & 0xff]) |
+           (uint64_t(morton_table::spread2[(x >> 8) & 0xff]) << 16) |
+           (uint64_t(morton_table::spread2[(x >> 16) & 0xff]) << 32) |
+           (uint64_t(morton_table::spread2[(x >> 24) & 0xff]) << 48);
+#endif
+  }
+
+  RAJA_HOST_DEVICE static RAJA_INLINE uint64_t compact(uint64_t x)
+  {
+    return morton_compact2(x);
+  }
+};
+
+template <>
+struct MortonCode<3> {
+  static constexpr int max_bits = 21;
+
+  RAJA_HOST_DEVICE static RAJA_INLINE uint64_t spread(uint64_t x)
+  {
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+    return morton_spread3(x);
+#else
+    return uint64_t(morton_table::spread3[x & 0xff]) |
+           (uint64_t(morton_table::spread3[(x >> 8) & 0xff]) << 24) |
+           (uint64_t(morton_table::spread3[(x >> 16) & 0x1f]) << 48);
+#endif
+  }
+
+  RAJA_HOST_DEVICE static RAJA_INLINE uint64_t compact(uint64_t x)
+  {
+    return morton_compact3(x);
+  }
+};
+
+//! largest bits with bricks of side 2^bits no larger than min_size
+RAJA_HOST_DEVICE constexpr int morton_max_bits(uint64_t min_size,
+                                               int max_bits,
+                                               int bits = 0)
+{
+  return (bits < max_bits && (uint64_t(2) << bits) <= min_size)
+             ? morton_max_bits(min_size, max_bits, bits + 1)
+             : bits;
+}
+
+//! size of a dimension for choosing the bricks, zero sizes count as one
+template <typename IdxLin>
+RAJA_HOST_DEVICE RAJA_INLINE constexpr uint64_t morton_size(IdxLin size)
+{
+  return size > 0 ? uint64_t(size) : uint64_t(1);
+}
+
+//! 1 if padding size to a multiple of 2^bits adds more than 1/16 of it
+RAJA_HOST_DEVICE RAJA_INLINE constexpr int morton_overpadded(int bits,
+                                                             uint64_t size)
+{
+  return 16 * (((size + (uint64_t(1) << bits) - 1) >> bits << bits) - size) >
+                 size
+             ? 1
+             : 0;
+}
+
+//! number of bits of each coordinate in the Morton part of the index
+template <typename... Sizes>
+RAJA_HOST_DEVICE constexpr int morton_bits(int bits, Sizes... sizes)
+{
+  return bits == 0 || sum<int>(morton_overpadded(bits, sizes)...) == 0
+             ? bits
+             : morton_bits(bits - 1, sizes...);
+}
+
+//! mask of the bits of dimension dim in the Morton part of the index
+RAJA_HOST_DEVICE constexpr uint64_t morton_mask(size_t n_dims,
+                                                camp::idx_t dim,
+                                                int bits)
+{
+  return bits == 0 ? uint64_t(0)
+                   : morton_mask(n_dims, dim, bits - 1) |
+                         (uint64_t(1) << (n_dims * (bits - 1) + n_dims - 1 -
+                                          dim));
+}
+
+template <typename Range, typename IdxLin = Index_type>
+struct MortonLayoutBase_impl;
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+struct MortonLayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin> {
+public:
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::idx_seq<RangeInts...>;
+  using Code = MortonCode<sizeof...(RangeInts)>;
+
+  //! layout of the grid of bricks
+  using BrickLayout = LayoutBase_impl<IndexRange, IdxLin>;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+
+  IdxLin sizes[n_dims];
+  int bits;
+  uint64_t masks[n_dims];
+  BrickLayout bricks;
+
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr MortonLayoutBase_impl()
+      : sizes{0}, bits{0}, masks{0}, bricks{}
+  {
+  }
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr MortonLayoutBase_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...},
+        bits{morton_bits(
+            morton_max_bits(foldl(RAJA::operators::minimum<uint64_t>(),
+                                  morton_size(sizes[RangeInts])...),
+                            Code::max_bits),
+            morton_size(sizes[RangeInts])...)},
+        masks{morton_mask(n_dims, RangeInts, bits)...},
+        bricks{((sizes[RangeInts] + (IdxLin(1) << bits) - 1) >> bits)...}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+  }
+
+  /*!
+   * Methods to performs bounds checking in layout objects
+   */
+  template <camp::idx_t N, typename Idx>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(Idx idx) const
+  {
+    printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+           static_cast<int>(N),
+           static_cast<long int>(idx),
+           static_cast<long int>(sizes[N] - 1));
+    RAJA_ABORT_OR_THROW("Out of bounds error \n");
+  }
+
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx,
+                                                Indices... indices) const
+  {
+    if (!(0 <= idx && idx < static_cast<Idx>(sizes[N]))) {
+      BoundsCheckError<N>(idx);
+    }
+    RAJA_UNUSED_VAR(idx);
+    BoundsCheck<N + 1>(indices...);
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   * The low bits of the indices are interleaved, and the high bits
+   * select a brick in row-major order.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE RAJA_BOUNDS_CHECK_constexpr IdxLin operator()(
+      Indices... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(indices...);
+#endif
+    return (bricks((IdxLin(indices) >> bits)...) << (n_dims * bits)) +
+           static_cast<IdxLin>(
+               foldl(RAJA::operators::bit_or<uint64_t>(),
+                     deposit(static_cast<uint64_t>(indices), RangeInts)...));
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * Linear indices in the padding of the bricks on the upper boundary give
+   * indices beyond the sizes of the layout.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    const uint64_t code = static_cast<uint64_t>(linear_index) &
+                          ((uint64_t(1) << (n_dims * bits)) - 1);
+    bricks.toIndices(linear_index >> (n_dims * bits), indices...);
+    camp::sink((indices = (camp::decay<Indices>)(
+                    (IdxLin(indices) << bits) |
+                    static_cast<IdxLin>(extract(code, RangeInts))))...);
+  }
+
+  /*!
+   * Computes a total size of the layout's space.
+   * This includes the padding of the bricks on the upper boundary.
+   *
+   * @return Total size spanned by indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return bricks.size() << (n_dims * bits);
+  }
+
+private:
+  //! the low bits of index, moved to the bits of dimension dim
+  RAJA_INLINE RAJA_HOST_DEVICE uint64_t deposit(uint64_t index,
+                                                camp::idx_t dim) const
+  {
+#if defined(RAJA_MORTON_USE_PDEP)
+    return _pdep_u64(index, masks[dim]);
+#else
+    return Code::spread(index & ((uint64_t(1) << bits) - 1))
+           << (n_dims - 1 - dim);
+#endif
+  }
+
+  //! the bits of dimension dim of code, moved to the low bits
+  RAJA_INLINE RAJA_HOST_DEVICE uint64_t extract(uint64_t code,
+                                                camp::idx_t dim) const
+  {
+#if defined(RAJA_MORTON_USE_PDEP)
+    return _pext_u64(code, masks[dim]);
+#else
+    return Code::compact(code >> (n_dims - 1 - dim));
+#endif
+  }
+};
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+constexpr size_t
+    MortonLayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin>::n_dims;
+
+}  // namespace detail
+
+/*!
+ * @brief A mapping of 2 or 3-dimensional index space to a linear index
+ * space along a Z-order (Morton) curve.
+ *
+ * The space is split into cubic bricks with a power of two side, the
+ * largest that fits in every dimension and pads none of them by more than
+ * a sixteenth. Sizes that are the same power of two make a single brick.
+ * The elements of a brick are
+ * ordered by interleaving the bits of their indices, the last (right-most)
+ * index in the lowest bit, so neighbors in every direction tend to be
+ * near in memory. The bricks are ordered like the elements of a Layout.
+ * The bricks on the upper boundary are padded, so size() may be larger
+ * than the product of the sizes; allocate size() elements for a View.
+ *
+ * For example:
+ *
+ *     // 96x96x96 elements in 32x32x32 bricks, 3x3x3 bricks
+ *     View<double, MortonLayout<3>> A(data, 96, 96, 96);
+ *
+ * The bits are interleaved with the BMI2 pdep instruction when the
+ * compiler targets it, and with tables of the spread bits of each byte
+ * otherwise.
+ */
+template <size_t n_dims, typename IdxLin = Index_type>
+using MortonLayout =
+    detail::MortonLayoutBase_impl<camp::make_idx_seq_t<n_dims>, IdxLin>;
+
+}  // namespace RAJA
+
+#endif  // RAJA_util_MortonLayout_HPP
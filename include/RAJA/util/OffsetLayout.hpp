@@ -103,6 +103,23 @@ struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
     return base_((indices - offsets[RangeInts])...);
   }
 
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout, shifted by the offsets.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices&&... indices) const
+  {
+    base_.toIndices(linear_index, indices...);
+    camp::sink((indices = (camp::decay<Indices>)(indices +
+                                                 offsets[RangeInts]))...);
+  }
+
   static RAJA_INLINE OffsetLayout_impl<IndexRange, IdxLin>
   from_layout_and_offsets(
       const std::array<IdxLin, sizeof...(RangeInts)>& offsets_in,
@@ -159,6 +176,24 @@ struct TypedOffsetLayout<IdxLin, camp::tuple<DimTypes...>>
     return IdxLin(Base::operator()(stripIndexType(indices)...));
   }
 
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              DimTypes&... indices) const
+  {
+    toIndicesHelper(camp::make_idx_seq_t<sizeof...(DimTypes)>{},
+                    linear_index,
+                    indices...);
+  }
+
+private:
+  template <typename... Indices, camp::idx_t... RangeInts>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndicesHelper(camp::idx_seq<RangeInts...>,
+                                                    IdxLin linear_index,
+                                                    Indices&... indices) const
+  {
+    Index_type locals[sizeof...(DimTypes)];
+    Base::toIndices(stripIndexType(linear_index), locals[RangeInts]...);
+    camp::sink((indices = Indices{static_cast<Indices>(locals[RangeInts])})...);
+  }
 };
 
 
@@ -0,0 +1,236 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining TiledLayout, a N-dimensional index
+ *          calculator that stores data in contiguous tiles
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_TiledLayout_HPP
+#define RAJA_util_TiledLayout_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/Layout.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Returns the stride of dimension dim inside a tile with the given sizes,
+ * which is the product of the sizes of the dimensions after dim.
+ */
+template <typename IdxLin>
+RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin tile_inner_stride(camp::idx_t)
+{
+  return IdxLin(1);
+}
+
+template <typename IdxLin, typename... Rest>
+RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin tile_inner_stride(
+    camp::idx_t dim,
+    camp::idx_t size,
+    Rest... rest)
+{
+  return (dim < 0 ? IdxLin(size) : IdxLin(1)) *
+         tile_inner_stride<IdxLin>(dim - 1, rest...);
+}
+
+template <typename Range, typename Tiles, typename IdxLin = Index_type>
+struct TiledLayoutBase_impl;
+
+template <camp::idx_t... RangeInts, camp::idx_t... TileSizes, typename IdxLin>
+struct TiledLayoutBase_impl<camp::idx_seq<RangeInts...>,
+                            camp::idx_seq<TileSizes...>,
+                            IdxLin> {
+public:
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::idx_seq<RangeInts...>;
+
+  //! layout of the grid of tiles
+  using TileGridLayout = LayoutBase_impl<IndexRange, IdxLin>;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+
+  //! number of elements in each tile
+  static constexpr IdxLin tile_volume =
+      product<IdxLin>(IdxLin(TileSizes)...);
+
+  //! tile size of dimension Dim, as tile_size<Dim>::value
+  template <camp::idx_t Dim>
+  using tile_size = camp::seq_at<Dim, camp::idx_seq<TileSizes...>>;
+
+  static_assert(sizeof...(TileSizes) == n_dims,
+                "number of tile sizes must match number of dimensions");
+  static_assert(product<IdxLin>(IdxLin(TileSizes > 0)...) == IdxLin(1),
+                "tile sizes must be positive");
+
+  IdxLin sizes[n_dims];
+  TileGridLayout tiles;
+
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr TiledLayoutBase_impl()
+      : sizes{0}, tiles{}
+  {
+  }
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr TiledLayoutBase_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...},
+        tiles{((sizes[RangeInts] + IdxLin(TileSizes) - 1) /
+               IdxLin(TileSizes))...}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+  }
+
+  /*!
+   * Methods to performs bounds checking in layout objects
+   */
+  template <camp::idx_t N, typename Idx>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(Idx idx) const
+  {
+    printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+           static_cast<int>(N),
+           static_cast<long int>(idx),
+           static_cast<long int>(sizes[N] - 1));
+    RAJA_ABORT_OR_THROW("Out of bounds error \n");
+  }
+
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx,
+                                                Indices... indices) const
+  {
+    if (!(0 <= idx && idx < static_cast<Idx>(sizes[N]))) {
+      BoundsCheckError<N>(idx);
+    }
+    RAJA_UNUSED_VAR(idx);
+    BoundsCheck<N + 1>(indices...);
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   * The offset of the index's tile in the tile grid, times the tile volume,
+   * plus the offset of the index inside its tile.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE RAJA_BOUNDS_CHECK_constexpr IdxLin operator()(
+      Indices... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(indices...);
+#endif
+    return tiles((IdxLin(indices) / IdxLin(TileSizes))...) * tile_volume +
+           sum<IdxLin>(((IdxLin(indices) % IdxLin(TileSizes)) *
+                        tile_inner_stride<IdxLin>(RangeInts, TileSizes...))...);
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * Linear indices in the padding of the tiles on the upper boundary give
+   * indices beyond the sizes of the layout.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    const IdxLin inner = linear_index % tile_volume;
+    tiles.toIndices(linear_index / tile_volume, indices...);
+    camp::sink((indices = (camp::decay<Indices>)(
+                    indices * IdxLin(TileSizes) +
+                    (inner / tile_inner_stride<IdxLin>(RangeInts,
+                                                       TileSizes...)) %
+                        IdxLin(TileSizes)))...);
+  }
+
+  /*!
+   * Computes a total size of the layout's space.
+   * This includes the padding of the tiles on the upper boundary.
+   *
+   * @return Total size spanned by indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return tiles.size() * tile_volume;
+  }
+};
+
+template <camp::idx_t... RangeInts, camp::idx_t... TileSizes, typename IdxLin>
+constexpr size_t TiledLayoutBase_impl<camp::idx_seq<RangeInts...>,
+                                      camp::idx_seq<TileSizes...>,
+                                      IdxLin>::n_dims;
+template <camp::idx_t... RangeInts, camp::idx_t... TileSizes, typename IdxLin>
+constexpr IdxLin TiledLayoutBase_impl<camp::idx_seq<RangeInts...>,
+                                      camp::idx_seq<TileSizes...>,
+                                      IdxLin>::tile_volume;
+
+}  // namespace detail
+
+/*!
+ * @brief A mapping of n-dimensional index space to a linear index space
+ * that stores each tile of TileSizes contiguously.
+ *
+ * Tiles are ordered like the elements of a Layout over the grid of tiles,
+ * and the elements of a tile like the elements of a Layout of TileSizes,
+ * so the last (right-most) index has stride-1 inside a tile. The tiles on
+ * the upper boundary are padded to full tiles, so size() may be larger than
+ * the product of the sizes; allocate size() elements for a View.
+ *
+ * For example:
+ *
+ *     // 100x100x100 elements in 8x8x8 tiles of 512 contiguous elements
+ *     using layout_t = TiledLayout<3, 8, 8, 8>;
+ *     View<double, layout_t> A(data, 100, 100, 100);
+ *
+ * Constant tile sizes let the compiler turn the divisions by them into
+ * shifts and multiplies. A kernel Tile statement with the tile_layout
+ * policy walks the tiles of one dimension in storage order, see
+ * RAJA::tile_layout.
+ */
+template <size_t n_dims, camp::idx_t... TileSizes>
+using TiledLayout = detail::TiledLayoutBase_impl<camp::make_idx_seq_t<n_dims>,
+                                                 camp::idx_seq<TileSizes...>,
+                                                 Index_type>;
+
+}  // namespace RAJA
+
+#endif  // RAJA_util_TiledLayout_HPP
@@ -15,10 +15,16 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
 namespace RAJA
 {
 
@@ -185,4 +191,170 @@ void buildTypedIndexSetAligned(
   }
 }
 
+namespace
+{
+
+/*
+ * True when index ii does not follow index ii - 1.
+ */
+inline bool alignedRunBreak(const Index_type* const indices_in, Index_type ii)
+{
+  return indices_in[ii] != indices_in[ii - 1] + 1;
+}
+
+/*
+ * True when a range segment starts at index ii. buildTypedIndexSetAligned
+ * starts a range at the first index of a run of consecutive indices that
+ * is a multiple of RANGE_ALIGN and is followed by another index of the
+ * run, and the range takes the rest of the run. Every RANGE_ALIGN indices
+ * of a run hold a multiple, so ii is the first multiple of its run exactly
+ * when the run starts less than RANGE_ALIGN indices before ii.
+ */
+inline bool alignedRangeStart(const Index_type* const indices_in,
+                              Index_type length,
+                              Index_type ii)
+{
+  if (ii + 1 >= length || alignedRunBreak(indices_in, ii + 1)
+      || (indices_in[ii] % RANGE_ALIGN) != 0) {
+    return false;
+  }
+  if (ii < RANGE_ALIGN) {
+    return true;
+  }
+  for (Index_type jj = ii - RANGE_ALIGN + 1; jj <= ii; ++jj) {
+    if (alignedRunBreak(indices_in, jj)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+/*
+*************************************************************************
+*
+* Initialize index set with aligned Ranges and List segments from array
+* of indices with given length, using all OpenMP threads.
+*
+* Each thread finds the ranges that start in its block of the array. A
+* range that runs past the end of a block ends at the first break in the
+* following blocks, which every thread finds for its own block first.
+* The ranges and the lists between them are the segments of the serial
+* builder.
+*
+*************************************************************************
+*/
+
+void buildTypedIndexSetAlignedParallel(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& hiset,
+    const Index_type* const indices_in,
+    Index_type length)
+{
+  if (length == 0) return;
+
+  if (length <= RANGE_MIN_LENGTH) {
+    hiset.push_back(ListSegment(indices_in, length));
+    return;
+  }
+
+  /* ranges as [begin, end) positions in indices_in, by block */
+  using RangeList = std::vector<std::pair<Index_type, Index_type>>;
+  std::vector<RangeList> blockRanges;
+  std::vector<Index_type> nextBreak;
+  int numBlocks = 1;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp single
+#endif
+    {
+#if defined(RAJA_ENABLE_OPENMP)
+      numBlocks = omp_get_num_threads();
+#endif
+      blockRanges.resize(numBlocks);
+      nextBreak.assign(numBlocks + 1, length);
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+    const int block = omp_get_thread_num();
+#else
+    const int block = 0;
+#endif
+    const Index_type i0 = length * block / numBlocks;
+    const Index_type i1 = length * (block + 1) / numBlocks;
+
+    for (Index_type ii = std::max(i0, Index_type(1)); ii < i1; ++ii) {
+      if (alignedRunBreak(indices_in, ii)) {
+        nextBreak[block] = ii;
+        break;
+      }
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp barrier
+#pragma omp single
+#endif
+    for (int b = numBlocks - 1; b > 0; --b) {
+      nextBreak[b - 1] = std::min(nextBreak[b - 1], nextBreak[b]);
+    }
+
+    RangeList& ranges = blockRanges[block];
+    for (Index_type ii = i0; ii < i1; ++ii) {
+      if (alignedRangeStart(indices_in, length, ii)) {
+        Index_type end = ii + 1;
+        while (end < i1 && !alignedRunBreak(indices_in, end)) {
+          ++end;
+        }
+        if (end == i1) {
+          end = nextBreak[block + 1];
+        }
+        ranges.push_back(std::make_pair(ii, end));
+        ii = end - 1;
+      }
+    }
+  }
+
+  /* same cutoff as the serial builder */
+  Index_type docount = 1; /* zero length termination */
+  Index_type listBegin = 0;
+  for (RangeList const& ranges : blockRanges) {
+    for (auto const& range : ranges) {
+      if (range.first != listBegin) {
+        docount += 1 + (range.first - listBegin); /* length + singletons */
+      }
+      docount += 2; /* length + begin */
+      listBegin = range.second;
+    }
+  }
+  if (listBegin != length) {
+    docount += 1 + (length - listBegin);
+  }
+
+  if (docount < (length * (RANGE_ALIGN - 1)) / RANGE_ALIGN) {
+    listBegin = 0;
+    for (RangeList const& ranges : blockRanges) {
+      for (auto const& range : ranges) {
+        if (range.first != listBegin) {
+          hiset.push_back(ListSegment(&indices_in[listBegin],
+                                      range.first - listBegin));
+        }
+        const Index_type begin = indices_in[range.first];
+        hiset.push_back(
+            RangeSegment(begin, begin + (range.second - range.first)));
+        listBegin = range.second;
+      }
+    }
+    if (listBegin != length) {
+      hiset.push_back(
+          ListSegment(&indices_in[listBegin], length - listBegin));
+    }
+  } else {
+    hiset.push_back(ListSegment(indices_in, length));
+  }
+}
+
 }  // namespace RAJA
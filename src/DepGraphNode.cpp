@@ -3,7 +3,7 @@
  *
  * \file
  *
- * \brief   Implementation file for dependency graph node class.
+ * \brief   Implementation file for dependency graph node and graph classes.
  *
  ******************************************************************************
  */
@@ -16,13 +16,115 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include <iostream>
+#include <new>
 #include <string>
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <climits>
+#else
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#endif
+
 #include "RAJA/internal/DepGraphNode.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/util/macros.hpp"
 
 namespace RAJA
 {
 
+namespace
+{
+
+#if defined(__linux__)
+
+/*
+ * Block while the semaphore holds value. The kernel checks the value
+ * under its own lock, so a wake that comes first is never lost.
+ */
+void futex_wait(std::atomic<int>& sem, int value)
+{
+  syscall(SYS_futex,
+          reinterpret_cast<int*>(&sem),
+          FUTEX_WAIT_PRIVATE,
+          value,
+          nullptr,
+          nullptr,
+          0);
+}
+
+void futex_wake_all(std::atomic<int>& sem)
+{
+  syscall(SYS_futex,
+          reinterpret_cast<int*>(&sem),
+          FUTEX_WAKE_PRIVATE,
+          INT_MAX,
+          nullptr,
+          nullptr,
+          0);
+}
+
+#else
+
+/*
+ * Without futexes, blocked nodes share a small table of condition
+ * variables picked by node address.
+ */
+struct WaitBucket {
+  std::mutex mutex;
+  std::condition_variable cond;
+};
+
+WaitBucket& wait_bucket(void const* node)
+{
+  static WaitBucket buckets[64];
+  return buckets[(reinterpret_cast<std::uintptr_t>(node) / 256) % 64];
+}
+
+#endif
+
+}  // namespace
+
+/*
+ * Waiters register before they check the semaphore and satisfyOne()
+ * decrements it before it checks for waiters; both are sequentially
+ * consistent, so at least one of them sees the other.
+ */
+void DepGraphNode::waitBlocking()
+{
+  m_num_waiters.fetch_add(1);
+#if defined(__linux__)
+  int value;
+  while ((value = m_semaphore_value.load()) > 0) {
+    futex_wait(m_semaphore_value, value);
+  }
+#else
+  WaitBucket& bucket = wait_bucket(this);
+  {
+    std::unique_lock<std::mutex> lock(bucket.mutex);
+    bucket.cond.wait(lock, [this] { return m_semaphore_value.load() <= 0; });
+  }
+#endif
+  m_num_waiters.fetch_sub(1);
+}
+
+void DepGraphNode::wakeWaiters()
+{
+#if defined(__linux__)
+  futex_wake_all(m_semaphore_value);
+#else
+  WaitBucket& bucket = wait_bucket(this);
+  // a waiter holds the lock from its check until it sleeps
+  { std::lock_guard<std::mutex> lock(bucket.mutex); }
+  bucket.cond.notify_all();
+#endif
+}
+
 void DepGraphNode::print(std::ostream& os) const
 {
   os << "DepGraphNode : sem, reload value = " << m_semaphore_value << " , "
@@ -39,4 +141,74 @@ void DepGraphNode::print(std::ostream& os) const
   os << std::endl;
 }
 
+DepGraph::DepGraph(int num_nodes)
+    : m_nodes(nullptr), m_num_nodes(num_nodes), m_finalized(false)
+{
+  if (m_num_nodes > 0) {
+    m_nodes = allocate_aligned_type<DepGraphNode>(
+        alignof(DepGraphNode), m_num_nodes * sizeof(DepGraphNode));
+    for (int i = 0; i < m_num_nodes; ++i) {
+      new (&m_nodes[i]) DepGraphNode();
+    }
+  }
+}
+
+DepGraph::~DepGraph()
+{
+  if (m_nodes) {
+    for (int i = 0; i < m_num_nodes; ++i) {
+      m_nodes[i].~DepGraphNode();
+    }
+    free_aligned(m_nodes);
+  }
+}
+
+void DepGraph::addDependentTask(int node, int dep_node)
+{
+  if (node < 0 || dep_node <= node || dep_node >= m_num_nodes) {
+    RAJA_ABORT_OR_THROW("DepGraph: dependent task must come after its task");
+  }
+  m_edges.emplace_back(node, dep_node);
+  m_finalized = false;
+}
+
+void DepGraph::finalize()
+{
+  std::vector<int> offsets(m_num_nodes + 1, 0);
+  for (auto const& edge : m_edges) {
+    ++offsets[edge.first + 1];
+  }
+  for (int i = 0; i < m_num_nodes; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+
+  m_dep_tasks.resize(m_edges.size());
+  std::vector<int> next(offsets.begin(), offsets.end() - 1);
+  for (auto const& edge : m_edges) {
+    m_dep_tasks[next[edge.first]++] = edge.second;
+  }
+
+  for (int i = 0; i < m_num_nodes; ++i) {
+    DepGraphNode& node = m_nodes[i];
+    node.m_dep_task = m_dep_tasks.data() + offsets[i];
+    node.m_num_dep_tasks = offsets[i + 1] - offsets[i];
+    node.m_semaphore_reload_value = 0;
+  }
+  for (int dep : m_dep_tasks) {
+    ++m_nodes[dep].m_semaphore_reload_value;
+  }
+
+  reset();
+  m_finalized = true;
+}
+
+void DepGraph::print(std::ostream& os) const
+{
+  os << "DepGraph : num nodes = " << m_num_nodes << std::endl;
+  for (int i = 0; i < m_num_nodes; ++i) {
+    os << "  node " << i << " : ";
+    m_nodes[i].print(os);
+  }
+}
+
 }  // namespace RAJA
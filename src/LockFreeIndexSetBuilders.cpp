@@ -19,7 +19,11 @@
 #include <cstdlib>
 #include <cstring>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
@@ -45,6 +49,42 @@ namespace RAJA
  */
 #define PROFITABLE_ENTITY_THRESHOLD_BLOCK 100
 
+/*
+ * Set up the dependency graph of a block index set whose segment
+ * lane * numBlocks + block covers position block * numLanes + lane of the
+ * mesh. Neighboring positions are in different lanes, and the segment in
+ * the lower lane runs first, so neighboring segments never run at the same
+ * time while segments in the same lane run concurrently.
+ *
+ * Segments two positions apart may run at the same time with only one
+ * segment between them, so the builders make every segment at least two
+ * rows (planes in 3d, entities in 1d) thick. A stencil reaching one row
+ * either way from two such segments then never touches the same row.
+ */
+static void buildLaneDependencyGraph(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::RangeStrideSegment>& iset,
+    int numBlocks,
+    int numLanes)
+{
+  iset.initDependencyGraph();
+  RAJA::DepGraph* graph = iset.getDependencyGraph();
+
+  const int numPositions = numBlocks * numLanes;
+  for (int pos = 0; pos < numPositions; ++pos) {
+    const int lane = pos % numLanes;
+    for (int nbr = pos - 1; nbr <= pos + 1; nbr += 2) {
+      if (nbr >= 0 && nbr < numPositions && nbr % numLanes > lane) {
+        graph->addDependentTask(lane * numBlocks + pos / numLanes,
+                                (nbr % numLanes) * numBlocks + nbr / numLanes);
+      }
+    }
+  }
+
+  iset.finalizeDependencyGraph();
+}
+
 void buildLockFreeBlockIndexset(
     RAJA::TypedIndexSet<RAJA::RangeSegment,
                         RAJA::ListSegment,
@@ -55,45 +95,33 @@ void buildLockFreeBlockIndexset(
 {
   int numThreads = getMaxOMPThreadsCPU();
 
-  // printf("Lock-free created\n") ;
-
   if ((midDim | slowDim) == 0) /* 1d mesh */
   {
-    if (fastDim / PROFITABLE_ENTITY_THRESHOLD_BLOCK <= 1) {
-      // printf("%d %d\n", 0, fastDim) ;
+    if (fastDim / PROFITABLE_ENTITY_THRESHOLD_BLOCK <= 1
+        || fastDim / (6 * numThreads) == 0) {
       iset.push_back(RAJA::RangeSegment(0, fastDim));
     } else {
-      /* This just sets up the schedule -- a truly safe */
-      /* execution of this schedule would require a check */
-      /* for completion of dependent threads before execution. */
-
-      /* We might want to force one thread if the */
-      /* profitability ratio is really bad, but for */
-      /* now use the brain dead approach. */
+      /* Three segments per thread of at least two entities each, */
+      /* numbered by lane so that the segments of a lane are never */
+      /* next to each other. */
       int numSegments = numThreads * 3;
       for (int lane = 0; lane < 3; ++lane) {
         for (int i = lane; i < numSegments; i += 3) {
           Index_type start = i * fastDim / numSegments;
           Index_type end = (i + 1) * fastDim / numSegments;
-          // printf("%d %d\n", start, end) ;
           iset.push_back(RAJA::RangeSegment(start, end));
         }
       }
+      buildLaneDependencyGraph(iset, numThreads, 3);
     }
   } else if (slowDim == 0) /* 2d mesh */
   {
-    int rowsPerSegment = midDim / (3 * numThreads);
+    int rowsPerSegment = midDim / (6 * numThreads);
     if (rowsPerSegment == 0) {
-      // printf("%d %d\n", 0, fastDim*midDim) ;
       iset.push_back(RAJA::RangeSegment(0, fastDim * midDim));
     } else {
-      /* This just sets up the schedule -- a truly safe */
-      /* execution of this schedule would require a check */
-      /* for completion of dependent threads before execution. */
-
-      /* We might want to force one thread if the */
-      /* profitability ratio is really bad, but for */
-      /* now use the brain dead approach. */
+      /* Each thread's block of rows is split into three lanes of at */
+      /* least two rows each. */
       for (int lane = 0; lane < 3; ++lane) {
         for (int i = 0; i < numThreads; ++i) {
           Index_type startRow = i * midDim / numThreads;
@@ -101,98 +129,39 @@ void buildLockFreeBlockIndexset(
           Index_type start = startRow * fastDim;
           Index_type end = endRow * fastDim;
           Index_type len = end - start;
-          // printf("%d %d\n", start + (lane  )*len/3,
-          //                   start + (lane+1)*len/3  ) ;
           iset.push_back(RAJA::RangeSegment(start + (lane)*len / 3,
                                             start + (lane + 1) * len / 3));
         }
       }
+      buildLaneDependencyGraph(iset, numThreads, 3);
     }
   } else { /* 3d mesh */
 
-    // this requires dependence graph - commenting out for now
-
-    /* Need at least 3 full planes per thread */
-    /* and at least one segment per plane */
-    /*
-        const int segmentsPerThread = 2;
-        int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
-        if (rowsPerSegment == 0) {
-          // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
-          iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
-          printf(
-              "Failure to create lockfree indexset - not enough rows per "
-              "segment\n");
-          exit(-1);
-        } else {
-    */
-    /* This just sets up the schedule -- a truly safe */
-    /* execution of this schedule would require a check */
-    /* for completion of dependent threads before execution. */
-
-    /* We might want to force one thread if the */
-    /* profitability ratio is really bad, but for */
-    /* now use the brain dead approach. */
-    /*
-          for (int lane = 0; lane < segmentsPerThread; ++lane) {
-            for (int i = 0; i < numThreads; ++i) {
-              Index_type startPlane = i * slowDim / numThreads;
-              Index_type endPlane = (i + 1) * slowDim / numThreads;
-              Index_type start = startPlane * fastDim * midDim;
-              Index_type end = endPlane * fastDim * midDim;
-              Index_type len = end - start;
-              // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
-              //                   start + (lane+1)*len/segmentsPerThread  );
-              iset.push_back(
-                  RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
-                                     start + (lane + 1) * len /
-       segmentsPerThread));
-            }
-          }
-    */
-    /* Allocate dependency graph structures for index set segments */
-    /*
-          iset.initDependencyGraph();
-
-          if (segmentsPerThread == 1) {
-    */
-    /* This dependency graph should impose serialization */
-    /*
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreValue() = ((i
-       == 0) ? 0 : 1); task->semaphoreReloadValue() = ((i == 0) ? 0 : 1); if (i
-       != numThreads - 1) { task->numDepTasks() = 1; task->depTaskNum(0) = i +
-       1;
-              }
-            }
-          } else {
-    */
-    /* This dependency graph relies on omp schedule(static, 1) */
-    /* but allows a minimumal set of dependent tasks be used */
-    /*
-            int borderSeg = numThreads * (segmentsPerThread - 1);
-            for (int i = 1; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreReloadValue() =
-       1; task->numDepTasks() = 1; task->depTaskNum(0) = borderSeg + i - 1;
-
-              RAJA::DepGraphNode* border_task =
-                  iset.getSegmentInfo(borderSeg + i - 1)->getDepGraphNode();
-              border_task->semaphoreValue() = 1;
-              border_task->semaphoreReloadValue() = 1;
-              border_task->numDepTasks() = 1;
-              border_task->depTaskNum(0) = i;
-            }
-          }
-
-          iset.finalizeDependencyGraph();
+    /* Need at least two full planes per segment */
+    const int segmentsPerThread = 2;
+    int planesPerSegment = slowDim / (2 * segmentsPerThread * numThreads);
+    if (planesPerSegment == 0) {
+      iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
+    } else {
+      for (int lane = 0; lane < segmentsPerThread; ++lane) {
+        for (int i = 0; i < numThreads; ++i) {
+          Index_type startPlane = i * slowDim / numThreads;
+          Index_type endPlane = (i + 1) * slowDim / numThreads;
+          Index_type start = startPlane * fastDim * midDim;
+          Index_type end = endPlane * fastDim * midDim;
+          Index_type len = end - start;
+          iset.push_back(
+              RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
+                                 start
+                                     + (lane + 1) * len / segmentsPerThread));
         }
-    */
+      }
+      buildLaneDependencyGraph(iset, numThreads, segmentsPerThread);
+    }
   }
 
   /* Print the dependency schedule for segments */
-  // iset.print(std::cout);
+  // iset.getDependencyGraph()->print(std::cout);
 }
 
 /*
@@ -337,4 +306,452 @@ void buildLockFreeColorIndexset(
   delete[] workset;
 }
 
+/*
+ ******************************************************************************
+ *
+ * Helpers for the parallel color index set builder. Each thread works on
+ * one contiguous block of a range of items; without OpenMP there is one
+ * thread.
+ *
+ ******************************************************************************
+ */
+namespace
+{
+
+int colorThreadNum()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+int colorNumThreads()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  return omp_get_num_threads();
+#else
+  return 1;
+#endif
+}
+
+Index_type colorBlockBegin(Index_type n, int numBlocks, int block)
+{
+  return n * block / numBlocks;
+}
+
+/*
+ * The domains that touch each range in compressed rows: the domains of
+ * range r are rangeToDomain[rangeOffset[r] .. rangeOffset[r+1]).
+ */
+void invertDomainToRange(Index_type const* domainToRange,
+                         Index_type numEntity,
+                         int numRangePerDomain,
+                         Index_type numEntityRange,
+                         std::vector<Index_type>& rangeOffset,
+                         std::vector<Index_type>& rangeToDomain)
+{
+  const Index_type numLinks = numEntity * numRangePerDomain;
+  std::unique_ptr<std::atomic<Index_type>[]> cursor(
+      new std::atomic<Index_type>[numEntityRange]);
+  rangeOffset.assign(numEntityRange + 1, 0);
+  rangeToDomain.resize(numLinks);
+  bool badRange = false;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel reduction(|| : badRange)
+#endif
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for
+#endif
+    for (Index_type r = 0; r < numEntityRange; ++r) {
+      cursor[r].store(0, std::memory_order_relaxed);
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for
+#endif
+    for (Index_type l = 0; l < numLinks; ++l) {
+      const Index_type r = domainToRange[l];
+      if (r < 0 || r >= numEntityRange) {
+        badRange = true;
+      } else {
+        cursor[r].fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  if (badRange) {
+    RAJA_ABORT_OR_THROW(
+        "buildParallelColorIndexset: range index out of bounds");
+  }
+
+  for (Index_type r = 0; r < numEntityRange; ++r) {
+    rangeOffset[r + 1] = rangeOffset[r] + cursor[r].load();
+    cursor[r].store(rangeOffset[r], std::memory_order_relaxed);
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+  for (Index_type l = 0; l < numLinks; ++l) {
+    const Index_type r = domainToRange[l];
+    rangeToDomain[cursor[r].fetch_add(1, std::memory_order_relaxed)] =
+        l / numRangePerDomain;
+  }
+}
+
+/*
+ * Domains that share a range are neighbors and get different colors.
+ */
+struct ColorGraph {
+  Index_type const* domainToRange;
+  int numRangePerDomain;
+  Index_type const* rangeOffset;
+  Index_type const* rangeToDomain;
+
+  /* calls func(j) for every neighbor j of domain i, possibly more than once */
+  template <typename Func>
+  void forEachNeighbor(Index_type i, Func&& func) const
+  {
+    for (int k = 0; k < numRangePerDomain; ++k) {
+      const Index_type r = domainToRange[i * numRangePerDomain + k];
+      for (Index_type l = rangeOffset[r]; l < rangeOffset[r + 1]; ++l) {
+        const Index_type j = rangeToDomain[l];
+        if (j != i) {
+          func(j);
+        }
+      }
+    }
+  }
+};
+
+/*
+ * Colors that are used by neighbors of the current domain. A color c is
+ * forbidden while mark[c] equals the current stamp, so the marks never
+ * need to be cleared.
+ */
+struct ForbiddenColors {
+  std::vector<long long> mark;
+  long long stamp;
+
+  ForbiddenColors() : stamp(0) {}
+
+  void next() { ++stamp; }
+
+  void forbid(int c)
+  {
+    if (c >= static_cast<int>(mark.size())) {
+      mark.resize(2 * c + 2, 0);
+    }
+    mark[c] = stamp;
+  }
+
+  bool allowed(int c) const
+  {
+    return c >= static_cast<int>(mark.size()) || mark[c] != stamp;
+  }
+};
+
+}  // namespace
+
+/*
+ ******************************************************************************
+ *
+ * Build Lock-free "color" index set in parallel.
+ *
+ * Domains are colored with speculative greedy coloring: every domain in the
+ * work list takes the smallest color not used by a neighbor, all at once,
+ * and the larger of two neighbors that picked the same color is colored
+ * again in the next round. Then domains in colors larger than the average
+ * move to smaller colors that none of their neighbors use, and the larger
+ * of two neighbors that moved to the same color moves back.
+ *
+ * Note: Method assumes IndexSet ptr refers to an empty index set.
+ *
+ ******************************************************************************
+ */
+void buildParallelColorIndexset(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::RangeStrideSegment>& iset,
+    Index_type const* domainToRange,
+    int numEntity,
+    int numRangePerDomain,
+    int numEntityRange,
+    Index_type* elemPermutation,
+    Index_type* ielemPermutation)
+{
+  if (numEntity <= 0) {
+    return;
+  }
+
+  std::vector<Index_type> rangeOffsetVec;
+  std::vector<Index_type> rangeToDomainVec;
+  invertDomainToRange(domainToRange,
+                      numEntity,
+                      numRangePerDomain,
+                      numEntityRange,
+                      rangeOffsetVec,
+                      rangeToDomainVec);
+  const ColorGraph graph{domainToRange,
+                         numRangePerDomain,
+                         rangeOffsetVec.data(),
+                         rangeToDomainVec.data()};
+
+  std::unique_ptr<std::atomic<int>[]> color(new std::atomic<int>[numEntity]);
+
+  /* speculative greedy coloring */
+  std::vector<Index_type> work(numEntity);
+  int numColors = 0;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+  for (Index_type i = 0; i < numEntity; ++i) {
+    color[i].store(-1, std::memory_order_relaxed);
+    work[i] = i;
+  }
+
+  while (!work.empty()) {
+    const Index_type numWork = static_cast<Index_type>(work.size());
+    std::vector<std::vector<Index_type>> recolor(getMaxOMPThreadsCPU());
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel reduction(max : numColors)
+#endif
+    {
+      ForbiddenColors forbidden;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(dynamic, 256)
+#endif
+      for (Index_type w = 0; w < numWork; ++w) {
+        const Index_type i = work[w];
+        forbidden.next();
+        graph.forEachNeighbor(i, [&](Index_type j) {
+          const int c = color[j].load(std::memory_order_relaxed);
+          if (c >= 0) {
+            forbidden.forbid(c);
+          }
+        });
+        int c = 0;
+        while (!forbidden.allowed(c)) {
+          ++c;
+        }
+        color[i].store(c, std::memory_order_relaxed);
+      }
+
+      std::vector<Index_type>& mine = recolor[colorThreadNum()];
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(dynamic, 256)
+#endif
+      for (Index_type w = 0; w < numWork; ++w) {
+        const Index_type i = work[w];
+        const int c = color[i].load(std::memory_order_relaxed);
+        bool conflict = false;
+        graph.forEachNeighbor(i, [&](Index_type j) {
+          conflict = conflict
+                     || (j < i && color[j].load(std::memory_order_relaxed)
+                                      == c);
+        });
+        if (conflict) {
+          mine.push_back(i);
+        } else {
+          numColors = std::max(numColors, c + 1);
+        }
+      }
+    }
+
+    work.clear();
+    for (auto const& r : recolor) {
+      work.insert(work.end(), r.begin(), r.end());
+    }
+  }
+
+  /* move domains from large colors to small ones */
+  std::unique_ptr<std::atomic<Index_type>[]> colorSize(
+      new std::atomic<Index_type>[numColors]);
+  std::vector<int> oldColor(numEntity);
+  std::vector<unsigned char> moved(numEntity);
+  std::vector<unsigned char> isSource(numColors);
+  std::vector<unsigned char> isTarget(numColors);
+  const Index_type target = (numEntity + numColors - 1) / numColors;
+
+  for (int pass = 0; pass < 4; ++pass) {
+    for (int c = 0; c < numColors; ++c) {
+      colorSize[c].store(0, std::memory_order_relaxed);
+    }
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+    for (Index_type i = 0; i < numEntity; ++i) {
+      colorSize[color[i].load(std::memory_order_relaxed)].fetch_add(
+          1, std::memory_order_relaxed);
+    }
+
+    bool unbalanced = false;
+    for (int c = 0; c < numColors; ++c) {
+      const Index_type size = colorSize[c].load(std::memory_order_relaxed);
+      isSource[c] = size > target;
+      isTarget[c] = size < target;
+      unbalanced = unbalanced || isSource[c];
+    }
+    if (!unbalanced) {
+      break;
+    }
+
+    bool anyMoved = false;
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel reduction(|| : anyMoved)
+#endif
+    {
+      ForbiddenColors forbidden;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(dynamic, 256)
+#endif
+      for (Index_type i = 0; i < numEntity; ++i) {
+        const int c = color[i].load(std::memory_order_relaxed);
+        oldColor[i] = c;
+        moved[i] = 0;
+        if (!isSource[c]
+            || colorSize[c].fetch_sub(1, std::memory_order_relaxed)
+                   <= target) {
+          if (isSource[c]) {
+            colorSize[c].fetch_add(1, std::memory_order_relaxed);
+          }
+          continue;
+        }
+
+        forbidden.next();
+        graph.forEachNeighbor(i, [&](Index_type j) {
+          forbidden.forbid(color[j].load(std::memory_order_relaxed));
+        });
+
+        int newColor = -1;
+        for (int t = 0; t < numColors && newColor < 0; ++t) {
+          if (isTarget[t] && forbidden.allowed(t)) {
+            if (colorSize[t].fetch_add(1, std::memory_order_relaxed)
+                < target) {
+              newColor = t;
+            } else {
+              colorSize[t].fetch_sub(1, std::memory_order_relaxed);
+            }
+          }
+        }
+
+        if (newColor < 0) {
+          colorSize[c].fetch_add(1, std::memory_order_relaxed);
+        } else {
+          color[i].store(newColor, std::memory_order_relaxed);
+          moved[i] = 1;
+          anyMoved = true;
+        }
+      }
+
+      /* no domain moves into a source color, so moving back is safe */
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(dynamic, 256)
+#endif
+      for (Index_type i = 0; i < numEntity; ++i) {
+        if (moved[i]) {
+          const int c = color[i].load(std::memory_order_relaxed);
+          bool conflict = false;
+          graph.forEachNeighbor(i, [&](Index_type j) {
+            conflict = conflict
+                       || (j < i && moved[j]
+                           && color[j].load(std::memory_order_relaxed) == c);
+          });
+          if (conflict) {
+            color[i].store(oldColor[i], std::memory_order_relaxed);
+          }
+        }
+      }
+    }
+
+    if (!anyMoved) {
+      break;
+    }
+  }
+
+  /* sort domains by color, keeping domains of a color in order */
+  int numBlocks = 1;
+  std::vector<Index_type> blockCount;
+  std::vector<Index_type> workset(numEntity);
+  std::vector<Index_type> colorBegin(numColors + 1, 0);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp single
+#endif
+    {
+      numBlocks = colorNumThreads();
+      blockCount.assign(static_cast<size_t>(numBlocks) * numColors, 0);
+    }
+
+    const int b = colorThreadNum();
+    const Index_type i0 = colorBlockBegin(numEntity, numBlocks, b);
+    const Index_type i1 = colorBlockBegin(numEntity, numBlocks, b + 1);
+    Index_type* count = blockCount.data() + b * numColors;
+    for (Index_type i = i0; i < i1; ++i) {
+      ++count[color[i].load(std::memory_order_relaxed)];
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp barrier
+#pragma omp single
+#endif
+    {
+      Index_type offset = 0;
+      for (int c = 0; c < numColors; ++c) {
+        colorBegin[c] = offset;
+        for (int bb = 0; bb < numBlocks; ++bb) {
+          const Index_type n = blockCount[bb * numColors + c];
+          blockCount[bb * numColors + c] = offset;
+          offset += n;
+        }
+      }
+      colorBegin[numColors] = offset;
+    }
+
+    for (Index_type i = i0; i < i1; ++i) {
+      workset[count[color[i].load(std::memory_order_relaxed)]++] = i;
+    }
+  }
+
+  if (elemPermutation != 0l) {
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+    for (Index_type k = 0; k < numEntity; ++k) {
+      elemPermutation[k] = workset[k];
+      if (ielemPermutation != 0l) {
+        ielemPermutation[workset[k]] = k;
+      }
+    }
+  }
+
+  for (int c = 0; c < numColors; ++c) {
+    const Index_type begin = colorBegin[c];
+    const Index_type end = colorBegin[c + 1];
+    if (begin == end) {
+      continue;
+    }
+    if (elemPermutation != 0l) {
+      iset.push_back(RAJA::RangeSegment(begin, end));
+    } else if (workset[end - 1] - workset[begin] == end - begin - 1) {
+      /* domains of a color are sorted, so they are a range */
+      iset.push_back(RAJA::RangeSegment(workset[begin], workset[end - 1] + 1));
+    } else {
+      iset.push_back(RAJA::ListSegment(&workset[begin], end - begin));
+    }
+  }
+}
+
 }  // namespace RAJA
@@ -0,0 +1,23 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "tests/test-compact.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "../forall/test-forall-utils.hpp"
+#include "../forall/test-forall-execpol.hpp"
+
+using OpenMPCompactTypes = 
+  Test<camp::cartesian_product< OpenMPForallExecPols,
+                                CompactDataTypes >>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP, 
+                               CompactFunctionalTest, 
+                               OpenMPCompactTypes);
+
+#endif
@@ -0,0 +1,186 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_HPP__
+#define __TEST_COMPACT_HPP__
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include "camp/list.hpp"
+#include "camp/resource.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <vector>
+
+
+// Stream compaction functional test class
+template<typename T>
+class CompactFunctionalTest: public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(CompactFunctionalTest);
+
+
+// Define compaction data types
+using CompactDataTypes = camp::list< int,
+                                     long,
+                                     double >;
+
+
+template <typename T>
+struct CompactPred
+{
+  bool operator()(const T& val) const
+  {
+    return static_cast<int>(val) % 3 == 0;
+  }
+};
+
+template <typename T>
+std::vector<T> makeCompactTestData(int N)
+{
+  std::vector<T> data(N);
+  for (int i = 0; i < N; ++i) {
+    // small range so that unique finds runs of equal values
+    data[i] = static_cast<T>(rand() % 7);
+  }
+  return data;
+}
+
+template <typename EXEC_POLICY, typename T>
+void CopyIfFunctionalTest(int N)
+{
+  const std::vector<T> in = makeCompactTestData<T>(N);
+
+  std::vector<T> ref;
+  std::copy_if(
+      in.begin(), in.end(), std::back_inserter(ref), CompactPred<T>{});
+
+  std::vector<T> out(N);
+  auto out_end = RAJA::copy_if<EXEC_POLICY>(
+      in.data(), in.data() + N, out.data(), CompactPred<T>{});
+  ASSERT_EQ(out_end - out.data(), static_cast<long>(ref.size()));
+
+  std::vector<T> cont_out(N);
+  auto cont_end =
+      RAJA::copy_if<EXEC_POLICY>(in, cont_out.begin(), CompactPred<T>{});
+  ASSERT_EQ(cont_end - cont_out.begin(), static_cast<long>(ref.size()));
+
+  for (size_t i = 0; i < ref.size(); ++i) {
+    ASSERT_EQ(out[i], ref[i]) << "(at index " << i << ")";
+    ASSERT_EQ(cont_out[i], ref[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY, typename T>
+void PartitionFunctionalTest(int N)
+{
+  std::vector<T> data = makeCompactTestData<T>(N);
+  // tag every element with its position to check stability
+  for (int i = 0; i < N; ++i) {
+    data[i] = static_cast<T>(data[i] + 7 * i);
+  }
+
+  std::vector<T> ref(data);
+  auto ref_mid =
+      std::stable_partition(ref.begin(), ref.end(), CompactPred<T>{});
+
+  auto mid = RAJA::partition<EXEC_POLICY>(data, CompactPred<T>{});
+  ASSERT_EQ(mid - data.begin(), ref_mid - ref.begin());
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(data[i], ref[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY, typename T>
+void UniqueFunctionalTest(int N)
+{
+  std::vector<T> data = makeCompactTestData<T>(N);
+
+  std::vector<T> ref(data);
+  ref.erase(std::unique(ref.begin(), ref.end()), ref.end());
+
+  auto data_end = RAJA::unique<EXEC_POLICY>(data.data(), data.data() + N);
+  ASSERT_EQ(data_end - data.data(), static_cast<long>(ref.size()));
+
+  for (size_t i = 0; i < ref.size(); ++i) {
+    ASSERT_EQ(data[i], ref[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY>
+void ListSegmentIfFunctionalTest(int N)
+{
+  const std::vector<int> flags = makeCompactTestData<int>(N);
+
+  std::vector<RAJA::Index_type> ref;
+  for (int i = 0; i < N; ++i) {
+    if (flags[i] == 0) {
+      ref.push_back(i);
+    }
+  }
+
+  camp::resources::Resource host_res{camp::resources::Host()};
+  const int* f = flags.data();
+  RAJA::ListSegment list = RAJA::make_list_segment_if<EXEC_POLICY>(
+      RAJA::RangeSegment(0, N),
+      [=](RAJA::Index_type i) { return f[i] == 0; },
+      host_res);
+
+  ASSERT_TRUE(list.indicesEqual(ref.data(), ref.size()));
+}
+
+TYPED_TEST_P(CompactFunctionalTest, CopyIf)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  CopyIfFunctionalTest<EXEC_POLICY, DATA_TYPE>(0);
+  CopyIfFunctionalTest<EXEC_POLICY, DATA_TYPE>(357);
+  // large enough to be split into several blocks
+  CopyIfFunctionalTest<EXEC_POLICY, DATA_TYPE>(100003);
+}
+
+TYPED_TEST_P(CompactFunctionalTest, Partition)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  PartitionFunctionalTest<EXEC_POLICY, DATA_TYPE>(0);
+  PartitionFunctionalTest<EXEC_POLICY, DATA_TYPE>(357);
+  PartitionFunctionalTest<EXEC_POLICY, DATA_TYPE>(100003);
+}
+
+TYPED_TEST_P(CompactFunctionalTest, Unique)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  UniqueFunctionalTest<EXEC_POLICY, DATA_TYPE>(0);
+  UniqueFunctionalTest<EXEC_POLICY, DATA_TYPE>(357);
+  UniqueFunctionalTest<EXEC_POLICY, DATA_TYPE>(100003);
+}
+
+TYPED_TEST_P(CompactFunctionalTest, ListSegmentIf)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  ListSegmentIfFunctionalTest<EXEC_POLICY>(0);
+  ListSegmentIfFunctionalTest<EXEC_POLICY>(357);
+  ListSegmentIfFunctionalTest<EXEC_POLICY>(100003);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CompactFunctionalTest,
+                            CopyIf,
+                            Partition,
+                            Unique,
+                            ListSegmentIf);
+
+#endif // __TEST_COMPACT_HPP__
@@ -0,0 +1,23 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "tests/test-forall-indexset-taskgraph.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+using OpenMPForallIndexSetTaskGraphTypes =
+  Test< camp::cartesian_product<
+          camp::list<
+            RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>,
+            RAJA::ExecPolicy<RAJA::omp_taskgraph_interval_segit,
+                             RAJA::seq_exec> > > >::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP,
+                               ForallIndexSetTaskGraphTest,
+                               OpenMPForallIndexSetTaskGraphTypes);
+
+#endif
@@ -0,0 +1,177 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_INDEXSET_TASKGRAPH_HPP__
+#define __TEST_FORALL_INDEXSET_TASKGRAPH_HPP__
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include "../../test-forall-utils.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using LockFreeIndexSetType = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                                 RAJA::ListSegment,
+                                                 RAJA::RangeStrideSegment>;
+
+TYPED_TEST_SUITE_P(ForallIndexSetTaskGraphTest);
+template <typename T>
+class ForallIndexSetTaskGraphTest : public ::testing::Test
+{
+};
+
+//
+// Run a stencil that updates each index and its neighbors at distance
+// stride without atomics over a lock-free block index set. The counts
+// are only right if neighboring segments never run at the same time.
+//
+template <typename EXEC_POLICY>
+void ForallLockFreeStencilTest(RAJA::Index_type fastDim,
+                               RAJA::Index_type midDim,
+                               RAJA::Index_type slowDim,
+                               RAJA::Index_type stride)
+{
+  LockFreeIndexSetType iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, slowDim);
+
+  const RAJA::Index_type N = iset.getLength();
+  ASSERT_EQ(N,
+            fastDim * (midDim ? midDim : 1) * (slowDim ? slowDim : 1));
+
+  std::vector<int> test_array(N, 0);
+  std::vector<int> ref_array(N, 0);
+
+  for (RAJA::Index_type idx = 0; idx < N; ++idx) {
+    for (RAJA::Index_type nbr = idx - stride; nbr <= idx + stride;
+         nbr += stride) {
+      if (nbr >= 0 && nbr < N) {
+        ref_array[nbr] += 1;
+      }
+    }
+  }
+
+  int* test_ptr = test_array.data();
+  for (int rep = 0; rep < 2; ++rep) {
+    RAJA::forall<EXEC_POLICY>(iset, [=](RAJA::Index_type idx) {
+      for (RAJA::Index_type nbr = idx - stride; nbr <= idx + stride;
+           nbr += stride) {
+        if (nbr >= 0 && nbr < N) {
+          test_ptr[nbr] += 1;
+        }
+      }
+    });
+  }
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(test_array[i], 2 * ref_array[i]);
+  }
+}
+
+TYPED_TEST_P(ForallIndexSetTaskGraphTest, LockFreeBlockStencil)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  ForallLockFreeStencilTest<EXEC_POLICY>(5000, 0, 0, 1);
+  ForallLockFreeStencilTest<EXEC_POLICY>(40, 300, 0, 40);
+  ForallLockFreeStencilTest<EXEC_POLICY>(10, 10, 200, 100);
+}
+
+//
+// The thinnest meshes the builder splits, sized from the thread count the
+// builder sees: segments two rows (planes in 3d) thick, with the stencil
+// reaching one row either way. One row less gives a single segment.
+//
+TYPED_TEST_P(ForallIndexSetTaskGraphTest, LockFreeBlockStencilMinimal)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  const RAJA::Index_type nthreads = RAJA::getMaxOMPThreadsCPU();
+  const RAJA::Index_type fast1d = std::max<RAJA::Index_type>(6 * nthreads,
+                                                             200);
+
+  ForallLockFreeStencilTest<EXEC_POLICY>(fast1d, 0, 0, 1);
+  ForallLockFreeStencilTest<EXEC_POLICY>(8, 6 * nthreads, 0, 8);
+  ForallLockFreeStencilTest<EXEC_POLICY>(8, 6 * nthreads - 1, 0, 8);
+  ForallLockFreeStencilTest<EXEC_POLICY>(8, 3 * nthreads, 0, 8);
+  ForallLockFreeStencilTest<EXEC_POLICY>(4, 4, 4 * nthreads, 16);
+  ForallLockFreeStencilTest<EXEC_POLICY>(4, 4, 4 * nthreads - 1, 16);
+  ForallLockFreeStencilTest<EXEC_POLICY>(4, 4, 2 * nthreads, 16);
+
+  LockFreeIndexSetType iset2d;
+  RAJA::buildLockFreeBlockIndexset(iset2d, 8, 6 * nthreads, 0);
+  ASSERT_EQ(iset2d.getNumSegments(), static_cast<size_t>(3 * nthreads));
+
+  LockFreeIndexSetType iset3d;
+  RAJA::buildLockFreeBlockIndexset(iset3d, 4, 4, 4 * nthreads);
+  ASSERT_EQ(iset3d.getNumSegments(), static_cast<size_t>(2 * nthreads));
+}
+
+//
+// Chain every segment after the previous one and check that they run in
+// order, then let every segment wait on the first one only.
+//
+TYPED_TEST_P(ForallIndexSetTaskGraphTest, HandBuiltGraph)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  const int num_seg = 32;
+  const int seg_len = 4;
+
+  LockFreeIndexSetType iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * seg_len, (s + 1) * seg_len));
+  }
+
+  iset.initDependencyGraph();
+  for (int s = 0; s + 1 < num_seg; ++s) {
+    iset.getDependencyGraph()->addDependentTask(s, s + 1);
+  }
+  iset.finalizeDependencyGraph();
+  ASSERT_TRUE(iset.dependencyGraphSet());
+
+  std::vector<int> order;
+  order.reserve(num_seg * seg_len);
+  std::vector<int>* order_ptr = &order;
+  RAJA::forall<EXEC_POLICY>(iset, [=](RAJA::Index_type idx) {
+    order_ptr->push_back(static_cast<int>(idx));
+  });
+
+  ASSERT_EQ(order.size(), static_cast<size_t>(num_seg * seg_len));
+  for (int i = 0; i < num_seg * seg_len; ++i) {
+    ASSERT_EQ(order[i], i);
+  }
+
+  // a copy shares the graph until it gets its own: the first segment
+  // fans out to all the others
+  LockFreeIndexSetType iset_copy(iset);
+  ASSERT_EQ(iset_copy.getDependencyGraph(), iset.getDependencyGraph());
+  iset_copy.initDependencyGraph();
+  ASSERT_NE(iset_copy.getDependencyGraph(), iset.getDependencyGraph());
+  for (int s = 1; s < num_seg; ++s) {
+    iset_copy.getDependencyGraph()->addDependentTask(0, s);
+  }
+  iset_copy.finalizeDependencyGraph();
+  ASSERT_EQ(iset_copy.getDepGraphNode(0)->numDepTasks(), num_seg - 1);
+
+  std::vector<int> count(num_seg * seg_len, 0);
+  int* count_ptr = count.data();
+  RAJA::forall<EXEC_POLICY>(iset_copy, [=](RAJA::Index_type idx) {
+    count_ptr[idx] += 1;
+  });
+  for (int i = 0; i < num_seg * seg_len; ++i) {
+    ASSERT_EQ(count[i], 1);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallIndexSetTaskGraphTest,
+                            LockFreeBlockStencil,
+                            LockFreeBlockStencilMinimal,
+                            HandBuiltGraph);
+
+#endif  // __TEST_FORALL_INDEXSET_TASKGRAPH_HPP__
@@ -0,0 +1,25 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "tests/test-forall-reduce-array.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "../test-forall-execpol.hpp"
+#include "../test-reducepol.hpp"
+
+// Cartesian product of types for Threads tests
+using ThreadsForallReduceArrayTypes =
+  Test< camp::cartesian_product<ReduceArrayDataTypeList, 
+                                ThreadsForallExecPols,
+                                ThreadsReducePols>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Threads,
+                               ForallReduceArrayTest,
+                               ThreadsForallReduceArrayTypes);
+
+#endif
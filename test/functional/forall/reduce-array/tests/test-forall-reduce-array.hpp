@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REDUCE_ARRAY_HPP__
+#define __TEST_FORALL_REDUCE_ARRAY_HPP__
+
+#include "gtest/gtest.h"
+
+#include "../../test-forall-utils.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+TYPED_TEST_SUITE_P(ForallReduceArrayTest);
+template <typename T>
+class ForallReduceArrayTest : public ::testing::Test
+{
+};
+
+
+//
+// Data types for array reduction tests
+//
+using ReduceArrayDataTypeList = camp::list<int,
+                                           float,
+                                           double>;
+
+template <typename DATA_TYPE, typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceArrayTestImpl(RAJA::Index_type first,
+                               RAJA::Index_type last,
+                               RAJA::Index_type nbins)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  std::vector<DATA_TYPE> values(last);
+  std::vector<RAJA::Index_type> keys(last);
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    values[i] = static_cast<DATA_TYPE>(rand() % 100 - 50);
+    keys[i] = rand() % nbins;
+  }
+  DATA_TYPE* data = values.data();
+  RAJA::Index_type* key = keys.data();
+
+  std::vector<DATA_TYPE> ref_sum(nbins, DATA_TYPE(0));
+  std::vector<DATA_TYPE> ref_min(nbins, DATA_TYPE(1024));
+  std::vector<DATA_TYPE> ref_max(nbins, DATA_TYPE(-1024));
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    ref_sum[key[i]] += data[i];
+    ref_min[key[i]] = std::min(ref_min[key[i]], data[i]);
+    ref_max[key[i]] = std::max(ref_max[key[i]], data[i]);
+  }
+
+  RAJA::ReduceSumArray<REDUCE_POLICY, DATA_TYPE> sum(nbins, 0);
+  RAJA::ReduceMinArray<REDUCE_POLICY, DATA_TYPE> min(nbins, 1024);
+  RAJA::ReduceMaxArray<REDUCE_POLICY, DATA_TYPE> max(nbins, -1024);
+
+  ASSERT_EQ(sum.size(), nbins);
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    sum[key[idx]] += data[idx];
+    min.min(key[idx], data[idx]);
+    max.max(key[idx], data[idx]);
+  });
+
+  std::vector<DATA_TYPE> all(nbins);
+  sum.get(all.data());
+  for (RAJA::Index_type b = 0; b < nbins; ++b) {
+    ASSERT_EQ(all[b], ref_sum[b]);
+    ASSERT_EQ(min.get(b), ref_min[b]);
+    ASSERT_EQ(max.get(b), ref_max[b]);
+  }
+
+  sum.reset(5);
+
+  const int nloops = 3;
+
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+      sum.add(key[idx], data[idx]);
+    });
+  }
+
+  for (RAJA::Index_type b = 0; b < nbins; ++b) {
+    ASSERT_EQ(sum.get(b), static_cast<DATA_TYPE>(5 + nloops * ref_sum[b]));
+  }
+}
+
+
+TYPED_TEST_P(ForallReduceArrayTest, ReduceArrayForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallReduceArrayTestImpl<DATA_TYPE, EXEC_POLICY, REDUCE_POLICY>(0, 28, 4);
+  ForallReduceArrayTestImpl<DATA_TYPE, EXEC_POLICY, REDUCE_POLICY>(3, 642, 37);
+  ForallReduceArrayTestImpl<DATA_TYPE, EXEC_POLICY, REDUCE_POLICY>(0, 20573, 5000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceArrayTest,
+                            ReduceArrayForall);
+
+#endif  // __TEST_FORALL_REDUCE_ARRAY_HPP__
@@ -0,0 +1,28 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "tests/test-forall-reduce-repro.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "../test-forall-execpol.hpp"
+#include "../test-reducepol.hpp"
+
+using OpenMPReproReducePols = camp::list< RAJA::omp_reduce,
+                                          RAJA::omp_reduce_ordered >;
+
+// Cartesian product of types for OpenMP tests
+using OpenMPForallReduceReproTypes =
+  Test< camp::cartesian_product<ReduceReproDataTypeList, 
+                                OpenMPForallExecPols,
+                                OpenMPReproReducePols>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP,
+                               ForallReduceReproTest,
+                               OpenMPForallReduceReproTypes);
+
+#endif
@@ -0,0 +1,21 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "tests/test-forall-reduce-repro.hpp"
+
+#include "../test-forall-execpol.hpp"
+#include "../test-reducepol.hpp"
+
+// Cartesian product of types for Sequential tests
+using SequentialForallReduceReproTypes =
+  Test< camp::cartesian_product<ReduceReproDataTypeList, 
+                                SequentialForallExecPols,
+                                SequentialReducePols>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Sequential,
+                               ForallReduceReproTest,
+                               SequentialForallReduceReproTypes);
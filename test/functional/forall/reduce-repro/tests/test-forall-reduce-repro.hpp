@@ -0,0 +1,183 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REDUCE_REPRO_HPP__
+#define __TEST_FORALL_REDUCE_REPRO_HPP__
+
+#include "gtest/gtest.h"
+
+#include "../../test-forall-utils.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+TYPED_TEST_SUITE_P(ForallReduceReproTest);
+template <typename T>
+class ForallReduceReproTest : public ::testing::Test
+{
+};
+
+
+//
+// Data types for reproducible sum tests
+//
+using ReduceReproDataTypeList = camp::list<int,
+                                           float,
+                                           double>;
+
+template <typename DATA_TYPE>
+bool bitwiseEqual(DATA_TYPE a, DATA_TYPE b)
+{
+  return std::memcmp(&a, &b, sizeof(DATA_TYPE)) == 0;
+}
+
+template <typename DATA_TYPE>
+DATA_TYPE reproTestScale(unsigned h, std::true_type)
+{
+  // exponents spread over [-60, 60]
+  return static_cast<DATA_TYPE>(
+      std::ldexp(1.0, static_cast<int>((h >> 16) % 121) - 60));
+}
+
+template <typename DATA_TYPE>
+DATA_TYPE reproTestScale(unsigned, std::false_type)
+{
+  return DATA_TYPE(1);
+}
+
+template <typename DATA_TYPE>
+DATA_TYPE reproTestValue(RAJA::Index_type i)
+{
+  // hash of i, so the data does not depend on the state of rand()
+  const unsigned h = static_cast<unsigned>(i) * 2654435761u;
+  const DATA_TYPE sign = (h >> 31) ? DATA_TYPE(-1) : DATA_TYPE(1);
+  return sign * static_cast<DATA_TYPE>((h >> 8) % 100 + 1)
+         * reproTestScale<DATA_TYPE>(
+               h, std::is_floating_point<DATA_TYPE>{});
+}
+
+//
+// Puts a value and its negation at the front of the range, large enough
+// that adding the rest of the range to either one rounds it away. A plain
+// forward sum cancels the pair first and keeps the rest; a plain reverse
+// sum loses the rest. Integer sums are exact, so they are left as is.
+//
+template <typename DATA_TYPE>
+void makeReproOrderDependent(std::vector<DATA_TYPE>& values,
+                             RAJA::Index_type first,
+                             RAJA::Index_type last,
+                             std::true_type)
+{
+  DATA_TYPE bound(0);
+  for (RAJA::Index_type i = first + 2; i < last; ++i) {
+    bound += std::abs(values[i]);
+  }
+  const DATA_TYPE big = std::ldexp(
+      DATA_TYPE(1),
+      std::ilogb(bound) + std::numeric_limits<DATA_TYPE>::digits + 2);
+  values[first] = big;
+  values[first + 1] = -big;
+
+  DATA_TYPE plain_fwd(0);
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    plain_fwd += values[i];
+  }
+  DATA_TYPE plain_rev(0);
+  for (RAJA::Index_type i = last; i > first; --i) {
+    plain_rev += values[i - 1];
+  }
+  ASSERT_FALSE(bitwiseEqual(plain_fwd, plain_rev));
+}
+
+template <typename DATA_TYPE>
+void makeReproOrderDependent(std::vector<DATA_TYPE>&,
+                             RAJA::Index_type,
+                             RAJA::Index_type,
+                             std::false_type)
+{
+}
+
+
+template <typename DATA_TYPE, typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceReproTestImpl(RAJA::Index_type first, RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  std::vector<DATA_TYPE> values(last);
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    values[i] = reproTestValue<DATA_TYPE>(i);
+  }
+  makeReproOrderDependent(
+      values, first, last, std::is_floating_point<DATA_TYPE>{});
+  DATA_TYPE* data = values.data();
+
+  RAJA::ReduceReproSum<RAJA::seq_reduce, DATA_TYPE> fwd(0);
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    fwd += data[i];
+  }
+
+  RAJA::ReduceReproSum<RAJA::seq_reduce, DATA_TYPE> rev(0);
+  for (RAJA::Index_type i = last; i > first; --i) {
+    rev += data[i - 1];
+  }
+
+  const DATA_TYPE ref_sum = fwd.get();
+  ASSERT_TRUE(bitwiseEqual(rev.get(), ref_sum));
+
+  RAJA::ReduceReproSum<REDUCE_POLICY, DATA_TYPE> sum(0);
+  RAJA::ReduceReproSum<REDUCE_POLICY, DATA_TYPE> sum2(2);
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    sum  += data[idx];
+    sum2 += data[idx];
+  });
+
+  ASSERT_TRUE(bitwiseEqual(sum.get(), ref_sum));
+
+  RAJA::ReduceReproSum<RAJA::seq_reduce, DATA_TYPE> fwd2(2);
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    fwd2 += data[i];
+  }
+  ASSERT_TRUE(bitwiseEqual(sum2.get(), fwd2.get()));
+
+  sum.reset(0);
+
+  const int nloops = 3;
+
+  RAJA::ReduceReproSum<RAJA::seq_reduce, DATA_TYPE> ref_loops(0);
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+      sum += data[idx];
+    });
+    for (RAJA::Index_type i = first; i < last; ++i) {
+      ref_loops += data[i];
+    }
+  }
+
+  ASSERT_TRUE(bitwiseEqual(sum.get(), ref_loops.get()));
+}
+
+
+TYPED_TEST_P(ForallReduceReproTest, ReduceReproSumForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallReduceReproTestImpl<DATA_TYPE, EXEC_POLICY, REDUCE_POLICY>(0, 28);
+  ForallReduceReproTestImpl<DATA_TYPE, EXEC_POLICY, REDUCE_POLICY>(3, 642);
+  ForallReduceReproTestImpl<DATA_TYPE, EXEC_POLICY, REDUCE_POLICY>(0, 20573);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceReproTest,
+                            ReduceReproSumForall);
+
+#endif  // __TEST_FORALL_REDUCE_REPRO_HPP__
@@ -28,4 +28,18 @@ INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP,
                                ForallRegionTest,
                                OpenMPForallRegionTypes);
 
+using OpenMPTeamForallExecPols =
+  camp::list< RAJA::omp_team_for_nowait_exec,
+              RAJA::omp_team_for_exec >;
+
+using OpenMPTeamForallRegionTypes =
+  Test< camp::cartesian_product<IdxTypeList,
+                                HostResourceList,
+                                camp::list< RAJA::omp_team_region >,
+                                OpenMPTeamForallExecPols>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMPTeam,
+                               ForallRegionTest,
+                               OpenMPTeamForallRegionTypes);
+
 #endif
@@ -0,0 +1,22 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "tests/test-forall-region-team.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "../test-forall-utils.hpp"
+
+using OpenMPForallRegionTeamTypes =
+  Test< camp::cartesian_product<IdxTypeList,
+                                HostResourceList>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP,
+                               ForallRegionTeamTest,
+                               OpenMPForallRegionTeamTypes);
+
+#endif
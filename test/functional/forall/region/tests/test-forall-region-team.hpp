@@ -0,0 +1,153 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REGION_TEAM_HPP__
+#define __TEST_FORALL_REGION_TEAM_HPP__
+
+#include "RAJA/RAJA.hpp"
+
+#include "../../test-forall-utils.hpp"
+
+#include <vector>
+
+TYPED_TEST_SUITE_P(ForallRegionTeamTest);
+template <typename T>
+class ForallRegionTeamTest : public ::testing::Test
+{
+};
+
+//
+// Runs many cycles of short loops in one team region. Loops over the same
+// range only depend on each other at the same index; the shifted loop and
+// the reduction need the barriers the team adds or the final synchronize.
+//
+template <typename INDEX_TYPE, typename WORKING_RES>
+void ForallRegionTeamSequenceTest(INDEX_TYPE N, int num_cycles)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg(0, N);
+  RAJA::TypedRangeSegment<INDEX_TYPE> shifted(1, N);
+
+  INDEX_TYPE* a;
+  INDEX_TYPE* b;
+  INDEX_TYPE* test_array;
+
+  allocateForallTestData<INDEX_TYPE>(N, working_res, &a, &b, &test_array);
+
+  std::vector<long long> sums(num_cycles);
+  std::vector<INDEX_TYPE> firsts(num_cycles);
+
+  RAJA::region<RAJA::omp_team_region>([&]() {
+
+    for (int c = 0; c < num_cycles; ++c) {
+      const INDEX_TYPE ci = static_cast<INDEX_TYPE>(c);
+
+      RAJA::forall<RAJA::omp_team_for_nowait_exec>(
+          rseg, [=](INDEX_TYPE i) { a[i] = i + ci; });
+
+      RAJA::forall<RAJA::omp_team_for_nowait_exec>(
+          rseg, [=](INDEX_TYPE i) { b[i] = 2 * a[i]; });
+
+      RAJA::forall<RAJA::omp_team_for_nowait_exec>(
+          shifted, [=](INDEX_TYPE i) { a[i] = b[i - 1] + 1; });
+
+      RAJA::ReduceSum<RAJA::omp_reduce, long long> sum(0);
+      RAJA::forall<RAJA::omp_team_for_nowait_exec>(
+          rseg, [=](INDEX_TYPE i) { sum += a[i]; });
+
+      RAJA::synchronize<RAJA::omp_team_synchronize>();
+      sums[c] = sum.get();
+
+      RAJA::forall<RAJA::omp_team_for_exec>(
+          RAJA::TypedRangeSegment<INDEX_TYPE>(0, 1),
+          [=, &firsts](INDEX_TYPE) { firsts[c] = a[0]; });
+    }
+
+  });
+
+  for (int c = 0; c < num_cycles; ++c) {
+    const INDEX_TYPE ci = static_cast<INDEX_TYPE>(c);
+    // a[0] = ci, a[i] = 2 * (i - 1 + ci) + 1 for i > 0
+    long long expected = ci;
+    for (INDEX_TYPE i = 1; i < N; ++i) {
+      expected += 2 * (i - 1 + ci) + 1;
+    }
+    ASSERT_EQ(sums[c], expected);
+    ASSERT_EQ(firsts[c], ci);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res, a, b, test_array);
+}
+
+//
+// A team loop started inside a team loop runs on the calling thread.
+//
+template <typename INDEX_TYPE, typename WORKING_RES>
+void ForallRegionTeamNestedTest(INDEX_TYPE N)
+{
+  camp::resources::Resource working_res{WORKING_RES()};
+
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  allocateForallTestData<INDEX_TYPE>(N * N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  RAJA::region<RAJA::omp_team_region>([=]() {
+    RAJA::forall<RAJA::omp_team_for_exec>(
+        RAJA::TypedRangeSegment<INDEX_TYPE>(0, N), [=](INDEX_TYPE i) {
+          RAJA::forall<RAJA::omp_team_for_nowait_exec>(
+              RAJA::TypedRangeSegment<INDEX_TYPE>(0, N),
+              [=](INDEX_TYPE j) { working_array[i * N + j] = i + j; });
+        });
+  });
+
+  working_res.memcpy(check_array,
+                     working_array,
+                     sizeof(INDEX_TYPE) * N * N);
+
+  for (INDEX_TYPE i = 0; i < N; i++) {
+    for (INDEX_TYPE j = 0; j < N; j++) {
+      ASSERT_EQ(check_array[i * N + j], i + j);
+    }
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+TYPED_TEST_P(ForallRegionTeamTest, RegionTeamSequence)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ForallRegionTeamSequenceTest<INDEX_TYPE, WORKING_RES>(7, 10);
+  ForallRegionTeamSequenceTest<INDEX_TYPE, WORKING_RES>(113, 200);
+  ForallRegionTeamSequenceTest<INDEX_TYPE, WORKING_RES>(2556, 100);
+}
+
+TYPED_TEST_P(ForallRegionTeamTest, RegionTeamNested)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ForallRegionTeamNestedTest<INDEX_TYPE, WORKING_RES>(1);
+  ForallRegionTeamNestedTest<INDEX_TYPE, WORKING_RES>(37);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallRegionTeamTest,
+                            RegionTeamSequence,
+                            RegionTeamNested);
+
+#endif  // __TEST_FORALL_REGION_TEAM_HPP__
@@ -22,7 +22,10 @@ using OpenMPForallExecPols =
               // RAJA::omp_parallel_exec<RAJA::seq_exec>,
               RAJA::omp_for_nowait_exec,
               RAJA::omp_for_exec,
-              RAJA::omp_parallel_for_exec >;
+              RAJA::omp_parallel_for_exec,
+              RAJA::omp_parallel_for_dynamic< 4 >,
+              RAJA::omp_parallel_for_guided< >,
+              RAJA::omp_parallel_for_runtime >;
 #endif
 
 #if defined(RAJA_ENABLE_TBB)
@@ -34,6 +37,13 @@ using TBBForallExecPols = camp::list< RAJA::tbb_for_exec,
                                       RAJA::tbb_for_dynamic >;
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsForallExecPols = camp::list< RAJA::threads_for_exec,
+                                          RAJA::threads_for_static< >,
+                                          RAJA::threads_for_static< 8 >,
+                                          RAJA::threads_for_dynamic >;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetForallExecPols =
   camp::list< RAJA::omp_target_parallel_for_exec<8>,
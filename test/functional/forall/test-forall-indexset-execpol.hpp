@@ -24,6 +24,9 @@ using OpenMPForallIndexSetExecPols =
               RAJA::ExecPolicy<RAJA::omp_parallel_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_segit, RAJA::loop_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_segit, RAJA::simd_exec>,
+              RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::omp_taskgraph_interval_segit,
+                               RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_for_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_for_nowait_exec> >;
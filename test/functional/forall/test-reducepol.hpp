@@ -22,6 +22,10 @@ using OpenMPReducePols =
 using TBBReducePols = camp::list< RAJA::tbb_reduce >;
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsReducePols = camp::list< RAJA::threads_reduce >;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetReducePols =
   camp::list< RAJA::omp_target_reduce >;
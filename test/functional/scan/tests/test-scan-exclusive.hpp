@@ -87,7 +87,7 @@ void ScanExclusiveInplaceFunctionalTest(int N,
                     &work_in, &work_out,             
                     &host_in, &host_out);
 
-  std::iota(host_in, host_in + N, 1);
+  fillScanTestData(host_in, N);
 
   working_res.memcpy(work_in, host_in, sizeof(T) * N);
 
@@ -167,6 +167,10 @@ TYPED_TEST_P(ScanFunctionalTest, ScanInclusiveInplace)
   ScanExclusiveInplaceFunctionalTest<EXEC_POLICY,
                                      WORKING_RESOURCE,
                                      OP_TYPE>(32000, T(2));
+  ScanExclusiveInplaceFunctionalTest<EXEC_POLICY,
+                                     WORKING_RESOURCE,
+                                     OP_TYPE>(scanMultiRoundTestSize<T>(),
+                                              T(2));
 }
 
 REGISTER_TYPED_TEST_SUITE_P(ScanFunctionalTest, 
@@ -83,7 +83,7 @@ void ScanInclusiveInplaceFunctionalTest(int N)
                     &work_in, &work_out,             
                     &host_in, &host_out);
 
-  std::iota(host_in, host_in + N, 1);
+  fillScanTestData(host_in, N);
 
   working_res.memcpy(work_in, host_in, sizeof(T) * N);
 
@@ -132,6 +132,12 @@ TYPED_TEST_P(ScanFunctionalTest, ScanInclusiveInplace)
   ScanInclusiveInplaceFunctionalTest<EXEC_POLICY,
                                      WORKING_RESOURCE,
                                      OP_TYPE>(32000);
+
+  using T = typename OP_TYPE::result_type;
+
+  ScanInclusiveInplaceFunctionalTest<EXEC_POLICY,
+                                     WORKING_RESOURCE,
+                                     OP_TYPE>(scanMultiRoundTestSize<T>());
 }
 
 REGISTER_TYPED_TEST_SUITE_P(ScanFunctionalTest, 
@@ -0,0 +1,127 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_SEGMENTED_HPP__
+#define __TEST_SCAN_SEGMENTED_HPP__
+
+#include <cstdlib>
+#include <vector>
+
+#include "test-scan-utils.hpp"
+
+
+// Segmented scan functional test class
+template<typename T>
+class ScanSegmentedFunctionalTest: public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(ScanSegmentedFunctionalTest);
+
+
+// Keys made of runs with random lengths in [1, max_len]; key values are
+// reused, but never by adjacent runs
+inline std::vector<int> makeSegmentedTestKeys(int N, int max_len)
+{
+  std::vector<int> keys(N);
+  int key = 0;
+  for (int i = 0; i < N;) {
+    const int len = 1 + rand() % max_len;
+    key = (key + 1) % 3;
+    for (int j = 0; j < len && i < N; ++j, ++i) {
+      keys[i] = key;
+    }
+  }
+  return keys;
+}
+
+template <typename T>
+std::vector<T> makeSegmentedTestValues(int N)
+{
+  std::vector<T> vals(N);
+  for (int i = 0; i < N; ++i) {
+    vals[i] = static_cast<T>(rand() % 100 - 30);
+  }
+  return vals;
+}
+
+template <typename EXEC_POLICY, typename OP_TYPE>
+void SegmentedScanFunctionalTest(int N, int max_len)
+{
+  using T = typename OP_TYPE::result_type;
+
+  const std::vector<int> keys = makeSegmentedTestKeys(N, max_len);
+  const std::vector<T> vals = makeSegmentedTestValues<T>(N);
+  const T init = static_cast<T>(5);
+
+  std::vector<T> inc_ref(N);
+  std::vector<T> exc_ref(N);
+  std::vector<int> keys_ref;
+  std::vector<T> vals_ref;
+  for (int i = 0; i < N; ++i) {
+    if (i == 0 || keys[i] != keys[i - 1]) {
+      inc_ref[i] = vals[i];
+      exc_ref[i] = init;
+      keys_ref.push_back(keys[i]);
+      vals_ref.push_back(vals[i]);
+    } else {
+      inc_ref[i] = OP_TYPE{}(inc_ref[i - 1], vals[i]);
+      exc_ref[i] = OP_TYPE{}(exc_ref[i - 1], vals[i - 1]);
+      vals_ref.back() = OP_TYPE{}(vals_ref.back(), vals[i]);
+    }
+  }
+
+  std::vector<T> inc_out(N);
+  RAJA::inclusive_segmented_scan<EXEC_POLICY>(
+      keys.data(), keys.data() + N, vals.data(), inc_out.data(), OP_TYPE{});
+
+  // in-place on the values
+  std::vector<T> exc_out(vals);
+  RAJA::exclusive_segmented_scan<EXEC_POLICY>(keys.begin(),
+                                              keys.end(),
+                                              exc_out.begin(),
+                                              exc_out.begin(),
+                                              OP_TYPE{},
+                                              init);
+
+  std::vector<int> keys_out(N);
+  std::vector<T> vals_out(N);
+  const auto num_segments =
+      RAJA::reduce_by_key<EXEC_POLICY>(keys.data(),
+                                       keys.data() + N,
+                                       vals.data(),
+                                       keys_out.data(),
+                                       vals_out.data(),
+                                       OP_TYPE{});
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(inc_out[i], inc_ref[i]) << "(at index " << i << ")";
+    ASSERT_EQ(exc_out[i], exc_ref[i]) << "(at index " << i << ")";
+  }
+  ASSERT_EQ(static_cast<size_t>(num_segments), keys_ref.size());
+  for (size_t s = 0; s < keys_ref.size(); ++s) {
+    ASSERT_EQ(keys_out[s], keys_ref[s]) << "(at segment " << s << ")";
+    ASSERT_EQ(vals_out[s], vals_ref[s]) << "(at segment " << s << ")";
+  }
+}
+
+TYPED_TEST_P(ScanSegmentedFunctionalTest, ScanSegmented)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OP_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SegmentedScanFunctionalTest<EXEC_POLICY, OP_TYPE>(0, 1);
+  SegmentedScanFunctionalTest<EXEC_POLICY, OP_TYPE>(357, 5);
+  // many short segments, including segments of one element
+  SegmentedScanFunctionalTest<EXEC_POLICY, OP_TYPE>(100003, 1);
+  SegmentedScanFunctionalTest<EXEC_POLICY, OP_TYPE>(100003, 5);
+  // segments spanning several blocks
+  SegmentedScanFunctionalTest<EXEC_POLICY, OP_TYPE>(100003, 40000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanSegmentedFunctionalTest,
+                            ScanSegmented);
+
+#endif // __TEST_SCAN_SEGMENTED_HPP__
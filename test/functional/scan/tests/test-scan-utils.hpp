@@ -51,6 +51,36 @@ void allocScanTestData(int N,
   *host_out = host_res.allocate<T>(N);
 }
 
+//
+// Number of elements for which the blocked OpenMP scans take three rounds
+// of one block per thread, so the carry from one round to the next is
+// exercised.
+//
+template <typename T>
+int scanMultiRoundTestSize()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  return static_cast<int>(RAJA::impl::scan::detail::scan_block_bytes
+                          / sizeof(T))
+         * omp_get_max_threads() * 3;
+#else
+  return 65000;
+#endif
+}
+
+//
+// Fills data with values in [-50, 50] that sum to zero over every 101
+// elements, so that plus scans of any length stay exact and do not
+// overflow.
+//
+template <typename T>
+void fillScanTestData(T* data, int N)
+{
+  for (int i = 0; i < N; ++i) {
+    data[i] = static_cast<T>((i % 101) * 37 % 101 - 50);
+  }
+}
+
 template <typename T>
 void deallocScanTestData(camp::resources::Resource& work_res,
                          T* work_in, T* work_out,
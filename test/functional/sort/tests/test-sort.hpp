@@ -0,0 +1,155 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SORT_HPP__
+#define __TEST_SORT_HPP__
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include "camp/list.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+
+// Sort functional test class
+template<typename T>
+class SortFunctionalTest: public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(SortFunctionalTest);
+
+
+// Comparator that is not a plain less or greater, so it takes the
+// merge sort path; many keys compare equal, which exercises stability
+template <typename T>
+struct SortCoarseLess
+{
+  bool operator()(const T& lhs, const T& rhs) const
+  {
+    return static_cast<int>(lhs) / 16 < static_cast<int>(rhs) / 16;
+  }
+};
+
+template <typename COMP>
+struct SortKeyType;
+
+template <template <typename...> class COMP, typename T, typename... Rest>
+struct SortKeyType<COMP<T, Rest...>>
+{
+  using type = T;
+};
+
+// Define sort comparison types
+using SortCompareTypes = camp::list< RAJA::operators::less<int>,
+                                     RAJA::operators::greater<int>,
+                                     RAJA::operators::less<unsigned>,
+                                     RAJA::operators::less<double>,
+                                     RAJA::operators::greater<float>,
+                                     SortCoarseLess<int>,
+                                     SortCoarseLess<double> >;
+
+
+template <typename T>
+std::vector<T> makeSortTestKeys(int N)
+{
+  std::vector<T> keys(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = static_cast<T>(rand() % 2000 - 1000) / static_cast<T>(8);
+  }
+  return keys;
+}
+
+template <typename EXEC_POLICY, typename COMP>
+void SortKeysFunctionalTest(int N)
+{
+  using T = typename SortKeyType<COMP>::type;
+
+  std::vector<T> ref = makeSortTestKeys<T>(N);
+  std::vector<T> keys(ref);
+  std::vector<T> stable_keys(ref);
+
+  std::stable_sort(ref.begin(), ref.end(), COMP{});
+
+  RAJA::sort<EXEC_POLICY>(keys.data(), keys.data() + N, COMP{});
+  RAJA::stable_sort<EXEC_POLICY>(stable_keys, COMP{});
+
+  // keys that compare equal may be reordered by an unstable sort
+  for (int i = 0; i < N; ++i) {
+    ASSERT_FALSE(COMP{}(keys[i], ref[i]) || COMP{}(ref[i], keys[i]))
+        << "(at index " << i << ")";
+    ASSERT_EQ(stable_keys[i], ref[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY, typename COMP>
+void SortPairsFunctionalTest(int N)
+{
+  using T = typename SortKeyType<COMP>::type;
+
+  const std::vector<T> orig = makeSortTestKeys<T>(N);
+
+  std::vector<int> ref_idx(N);
+  for (int i = 0; i < N; ++i) {
+    ref_idx[i] = i;
+  }
+  std::stable_sort(ref_idx.begin(), ref_idx.end(), [&](int a, int b) {
+    return COMP{}(orig[a], orig[b]);
+  });
+
+  std::vector<T> keys(orig);
+  std::vector<int> vals(N);
+  for (int i = 0; i < N; ++i) {
+    vals[i] = i;
+  }
+  std::vector<T> stable_keys(keys);
+  std::vector<int> stable_vals(vals);
+
+  RAJA::sort_pairs<EXEC_POLICY>(keys.begin(), keys.end(), vals.begin(),
+                                COMP{});
+  RAJA::stable_sort_pairs<EXEC_POLICY>(stable_keys, stable_vals, COMP{});
+
+  for (int i = 0; i < N; ++i) {
+    // values must stay attached to their keys
+    ASSERT_EQ(keys[i], orig[vals[i]]) << "(at index " << i << ")";
+    ASSERT_FALSE(COMP{}(keys[i], orig[ref_idx[i]])
+                 || COMP{}(orig[ref_idx[i]], keys[i]))
+        << "(at index " << i << ")";
+    ASSERT_EQ(stable_vals[i], ref_idx[i]) << "(at index " << i << ")";
+    ASSERT_EQ(stable_keys[i], orig[ref_idx[i]]) << "(at index " << i << ")";
+  }
+}
+
+TYPED_TEST_P(SortFunctionalTest, Sort)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using COMP        = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SortKeysFunctionalTest<EXEC_POLICY, COMP>(0);
+  SortKeysFunctionalTest<EXEC_POLICY, COMP>(357);
+  SortKeysFunctionalTest<EXEC_POLICY, COMP>(32000);
+  // large enough to be split into several blocks
+  SortKeysFunctionalTest<EXEC_POLICY, COMP>(100003);
+}
+
+TYPED_TEST_P(SortFunctionalTest, SortPairs)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using COMP        = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SortPairsFunctionalTest<EXEC_POLICY, COMP>(0);
+  SortPairsFunctionalTest<EXEC_POLICY, COMP>(357);
+  SortPairsFunctionalTest<EXEC_POLICY, COMP>(32000);
+  SortPairsFunctionalTest<EXEC_POLICY, COMP>(100003);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SortFunctionalTest,
+                            Sort,
+                            SortPairs);
+
+#endif // __TEST_SORT_HPP__
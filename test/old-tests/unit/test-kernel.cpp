@@ -9,6 +9,7 @@
 #include "RAJA_gtest.hpp"
 
 #include <cstdio>
+#include <vector>
 
 #if defined(RAJA_ENABLE_CUDA)
 #include <cuda_runtime.h>
@@ -442,6 +443,16 @@ using OMPTypes = ::testing::Types<
                              RAJA::omp_parallel_for_exec,
                              For<1, RAJA::loop_exec, For<0, s, Lambda<0>>>>>,
          list<TypedIndex, Index_type>,
+         RAJA::omp_reduce>,
+    list<KernelPolicy<For<1,
+                          RAJA::omp_parallel_for_dynamic<2>,
+                          For<0, s, Lambda<0>>>>,
+         list<TypedIndex, Index_type>,
+         RAJA::omp_reduce>,
+    list<KernelPolicy<For<1,
+                          RAJA::omp_parallel_for_guided<>,
+                          For<0, s, Lambda<0>>>>,
+         list<TypedIndex, Index_type>,
          RAJA::omp_reduce>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP, Kernel, OMPTypes);
 #endif
@@ -452,6 +463,19 @@ using TBBTypes = ::testing::Types<
          RAJA::tbb_reduce>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(TBB, Kernel, TBBTypes);
 #endif
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsTypes = ::testing::Types<
+    list<KernelPolicy<For<1, RAJA::threads_for_exec, For<0, s, Lambda<0>>>>,
+         list<TypedIndex, Index_type>,
+         RAJA::threads_reduce>,
+    // nested parallel loops share the same pool threads
+    list<KernelPolicy<For<1,
+                          RAJA::threads_for_exec,
+                          For<0, RAJA::threads_for_static<>, Lambda<0>>>>,
+         list<TypedIndex, Index_type>,
+         RAJA::threads_reduce>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(Threads, Kernel, ThreadsTypes);
+#endif
 #if defined(RAJA_ENABLE_CUDA)
 using CUDATypes = ::testing::Types<
     list<KernelPolicy<For<
@@ -1190,6 +1214,124 @@ TEST(Kernel, ForICountTyped_simd)
 
 
 
+TEST(Kernel, ViewCursorLTimes)
+{
+  using namespace RAJA;
+
+  constexpr Index_type num_m = 3;
+  constexpr Index_type num_d = 4;
+  constexpr Index_type num_g = 5;
+  constexpr Index_type num_z = 11;
+
+  using LView = View<double, Layout<2, Index_type, 1>>;
+  using PsiView = View<double, Layout<3, Index_type, 2>>;
+  using PhiView = View<double, Layout<3, Index_type, 2>>;
+
+  // kernel arguments are (m, d, g, z)
+  using LCursor = ViewCursor<LView, 0, 1>;
+  using PsiCursor = ViewCursor<PsiView, 1, 2, 3>;
+  using PhiCursor = ViewCursor<PhiView, 0, 2, 3>;
+
+  std::vector<double> L_data(num_m * num_d);
+  std::vector<double> psi_data(num_d * num_g * num_z);
+  std::vector<double> phi_data(num_m * num_g * num_z, 0.0);
+  std::vector<double> phi_ref(num_m * num_g * num_z, 0.0);
+
+  for (size_t i = 0; i < L_data.size(); ++i) {
+    L_data[i] = i + 1;
+  }
+  for (size_t i = 0; i < psi_data.size(); ++i) {
+    psi_data[i] = 2 * i + 1;
+  }
+
+  LView L(L_data.data(), num_m, num_d);
+  PsiView psi(psi_data.data(), num_d, num_g, num_z);
+  PhiView phi(phi_data.data(), num_m, num_g, num_z);
+  PhiView ref(phi_ref.data(), num_m, num_g, num_z);
+
+  // the cursors of the z loop also move inside tiles
+  using Pol = KernelPolicy<
+      For<0, seq_exec,
+        For<1, seq_exec,
+          For<2, seq_exec,
+            Tile<3, tile_fixed<4>, seq_exec,
+              For<3, simd_exec,
+                Lambda<0, Params<0, 1, 2>>
+              >
+            >
+          >
+        >
+      >
+    >;
+
+  kernel_param<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, num_m),
+                       RangeSegment(0, num_d),
+                       RangeSegment(0, num_g),
+                       RangeSegment(0, num_z)),
+      RAJA::make_tuple(PhiCursor(phi), LCursor(L), PsiCursor(psi)),
+
+      [=](PhiCursor &phi_c, LCursor &L_c, PsiCursor &psi_c) {
+        phi_c() += L_c() * psi_c();
+      });
+
+  for (Index_type m = 0; m < num_m; ++m) {
+    for (Index_type d = 0; d < num_d; ++d) {
+      for (Index_type g = 0; g < num_g; ++g) {
+        for (Index_type z = 0; z < num_z; ++z) {
+          ref(m, g, z) += L(m, d) * psi(d, g, z);
+        }
+      }
+    }
+  }
+
+  for (size_t i = 0; i < phi_data.size(); ++i) {
+    ASSERT_EQ(phi_ref[i], phi_data[i]);
+  }
+}
+
+TEST(Kernel, ViewCursorTypedOffset)
+{
+  using namespace RAJA;
+
+  using layout_t = TypedLayout<Index_type, camp::tuple<ZoneI, ZoneJ>>;
+
+  std::vector<int> data(6 * 7, -1);
+  View<int, layout_t> base(data.data(), layout_t(6, 7));
+
+  // indices (-2:3, 3:9)
+  auto view = base.shift({{-2, 3}});
+  using cursor_t = ViewCursor<decltype(view), 0, 1>;
+
+  // j outer, i inner, with the inner count in Param<1>
+  using Pol = KernelPolicy<
+      For<1, seq_exec,
+        ForICount<0, Param<1>, seq_exec,
+          Lambda<0>
+        >
+      >
+    >;
+
+  kernel_param<Pol>(
+
+      RAJA::make_tuple(TypedRangeSegment<ZoneI>(-2, 4),
+                       TypedRangeSegment<ZoneJ>(3, 10)),
+      RAJA::make_tuple(cursor_t(view), (RAJA::Index_type)0),
+
+      [=](ZoneI RAJA_UNUSED_ARG(i),
+          ZoneJ j,
+          cursor_t &c,
+          RAJA::Index_type ii) { c() = 100 * ii + *j; });
+
+  for (int i = -2; i < 4; ++i) {
+    for (int j = 3; j < 10; ++j) {
+      ASSERT_EQ(100 * (i + 2) + j, view(ZoneI(i), ZoneJ(j)));
+    }
+  }
+}
+
+
 TEST(Kernel, Tile)
 {
   using namespace RAJA;
@@ -1626,6 +1768,84 @@ TEST(Kernel, Collapse8)
   delete[] data;
 }
 
+
+TEST(Kernel, Collapse9)
+{
+
+  int N = 3;
+  int M = 5;
+  int K = 4;
+  int P = 7;
+  int Q = 2;
+
+  int *data = new int[N * M * K * P * Q];
+  for (int i = 0; i < N * M * K * P * Q; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                ArgList<0, 1, 2, 3, 4>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, Q),
+                       RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, P)),
+      [=](Index_type q,
+          Index_type k,
+          Index_type j,
+          Index_type i,
+          Index_type r) {
+        Index_type id = r + P * (i + N * (j + M * (k + K * q)));
+        data[id] += id;
+      });
+
+  for (int id = 0; id < N * M * K * P * Q; ++id) {
+    ASSERT_EQ(data[id], id);
+  }
+
+  delete[] data;
+}
+
+
+TEST(Kernel, Collapse10)
+{
+
+  int N = 3;
+  int M = 3;
+  int K = 4;
+  int P = 8;
+
+  int *data = new int[N * K * P];
+  for (int i = 0; i < N * K * P; ++i) {
+    data[i] = 0;
+  }
+
+  // collapse non-adjacent arguments around an inner sequential loop
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                ArgList<0, 2, 3>,
+                                For<1, RAJA::seq_exec, Lambda<0>>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(1, P + 1)),
+      [=](Index_type k, Index_type j, Index_type i, Index_type r) {
+        data[(r - 1) + P * (i + N * k)] += j;
+      });
+
+  for (int id = 0; id < N * K * P; ++id) {
+    ASSERT_EQ(data[id], 3);
+  }
+
+  delete[] data;
+}
+
 #endif  // RAJA_ENABLE_OPENMP
 
 
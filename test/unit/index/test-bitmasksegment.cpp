@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for BitmaskSegment
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <vector>
+
+// every index of [begin, end) that is a multiple of 2 or 3, in reverse
+static std::vector<RAJA::Index_type> makeActive(RAJA::Index_type begin,
+                                                RAJA::Index_type end)
+{
+  std::vector<RAJA::Index_type> idx;
+  for (RAJA::Index_type i = end - 1; i >= begin; --i) {
+    if (i % 2 == 0 || i % 3 == 0) {
+      idx.push_back(i);
+    }
+  }
+  return idx;
+}
+
+TEST(BitmaskSegmentUnitTest, Constructors)
+{
+  std::vector<RAJA::Index_type> idx = makeActive(-10, 1000);
+
+  RAJA::BitmaskSegment seg(-10, 1000, &idx[0], idx.size());
+  ASSERT_EQ(RAJA::Index_type(idx.size()), seg.size());
+  ASSERT_EQ(RAJA::Index_type(16), seg.getNumWords());
+  ASSERT_EQ(-10, seg.getFirst());
+
+  RAJA::BitmaskSegment copied(seg);
+  ASSERT_EQ(seg, copied);
+  RAJA::BitmaskSegment moved(std::move(copied));
+  ASSERT_EQ(seg, moved);
+
+  std::vector<RAJA::Index_type> other{0, 1, 2};
+  RAJA::BitmaskSegment small(0, 3, &other[0], other.size());
+  std::swap(small, moved);
+  ASSERT_EQ(seg, small);
+  ASSERT_EQ(3, moved.size());
+
+  std::vector<RAJA::Index_type> outside{3, 1000};
+  ASSERT_ANY_THROW(RAJA::BitmaskSegment(0, 1000, &outside[0], 2));
+}
+
+TEST(BitmaskSegmentUnitTest, Iterators)
+{
+  std::vector<RAJA::Index_type> idx = makeActive(5, 700);
+  RAJA::BitmaskSegment seg(5, 700, &idx[0], idx.size());
+  std::sort(idx.begin(), idx.end());
+
+  ASSERT_EQ(RAJA::Index_type(idx.size()), seg.end() - seg.begin());
+  for (size_t i = 0; i < idx.size(); ++i) {
+    ASSERT_EQ(idx[i], seg.begin()[i]);
+  }
+  size_t i = 0;
+  for (RAJA::Index_type val : seg) {
+    ASSERT_EQ(idx[i++], val);
+  }
+}
+
+template <typename ExecPolicy>
+void testBitmaskForall()
+{
+  std::vector<RAJA::Index_type> idx = makeActive(0, 5000);
+  RAJA::BitmaskSegment seg(0, 5000, &idx[0], idx.size());
+
+  std::vector<int> count(5000, 0);
+  int* count_ptr = &count[0];
+  RAJA::forall<ExecPolicy>(seg, [=](RAJA::Index_type i) { count_ptr[i]++; });
+  for (RAJA::Index_type i = 0; i < 5000; ++i) {
+    ASSERT_EQ((i % 2 == 0 || i % 3 == 0) ? 1 : 0, count[i]);
+  }
+}
+
+TEST(BitmaskSegmentUnitTest, Forall)
+{
+  testBitmaskForall<RAJA::seq_exec>();
+  testBitmaskForall<RAJA::loop_exec>();
+  testBitmaskForall<RAJA::simd_exec>();
+#if defined(RAJA_ENABLE_OPENMP)
+  testBitmaskForall<RAJA::omp_parallel_for_exec>();
+#endif
+}
+
+TEST(BitmaskSegmentUnitTest, IndexSet)
+{
+  using IndexSetType =
+      RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::BitmaskSegment>;
+
+  std::vector<RAJA::Index_type> idx = makeActive(100, 1000);
+  IndexSetType iset;
+  iset.push_back(RAJA::RangeSegment(0, 100));
+  iset.push_back(RAJA::BitmaskSegment(100, 1000, &idx[0], idx.size()));
+  iset.push_back(RAJA::RangeSegment(1000, 1100));
+  ASSERT_EQ(size_t(200 + idx.size()), iset.getLength());
+
+  std::vector<int> count(1100, 0);
+  int* count_ptr = &count[0];
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::loop_exec>>(
+      iset, [=](RAJA::Index_type i) { count_ptr[i]++; });
+  for (RAJA::Index_type i = 0; i < 1100; ++i) {
+    const bool active =
+        i < 100 || i >= 1000 || i % 2 == 0 || i % 3 == 0;
+    ASSERT_EQ(active ? 1 : 0, count[i]);
+  }
+
+  RAJA::RAJAVec<RAJA::Index_type> indices;
+  getIndices(indices, iset);
+
+  std::vector<RAJA::Index_type> icount(1100, -1);
+  RAJA::Index_type* icount_ptr = &icount[0];
+  RAJA::forall_Icount<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [=](RAJA::Index_type ic, RAJA::Index_type i) {
+        icount_ptr[i] = ic;
+      });
+  for (size_t ic = 0; ic < indices.size(); ++ic) {
+    ASSERT_EQ(RAJA::Index_type(ic), icount[indices[ic]]);
+  }
+}
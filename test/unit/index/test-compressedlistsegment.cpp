@@ -0,0 +1,197 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for compressed list segments
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+#include <vector>
+
+template<typename T>
+class CompressedListSegmentUnitTest : public ::testing::Test {};
+
+using MyTypes = ::testing::Types<RAJA::Index_type,
+                                 int,
+#if defined(RAJA_TEST_EXHAUSTIVE)
+                                 unsigned int,
+                                 short,
+                                 unsigned short,
+                                 long,
+                                 unsigned long,
+#endif
+                                 unsigned long long>;
+
+TYPED_TEST_SUITE(CompressedListSegmentUnitTest, MyTypes);
+
+// runs of 1 to 20 consecutive indices with gaps of 1 to 7 between them
+template <typename T>
+std::vector<T> makeRunIndices(int len)
+{
+  std::vector<T> idx;
+  T next = 3;
+  for (int run = 0; static_cast<int>(idx.size()) < len; ++run) {
+    for (int i = 0; i < run % 20 + 1 && static_cast<int>(idx.size()) < len;
+         ++i) {
+      idx.push_back(next++);
+    }
+    next += run % 7 + 1;
+  }
+  return idx;
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Constructors)
+{
+  std::vector<TypeParam> idx = makeRunIndices<TypeParam>(500);
+
+  RAJA::TypedDeltaListSegment<TypeParam> delta(&idx[0], idx.size());
+  RAJA::TypedDeltaListSegment<TypeParam> delta_copied(delta);
+  ASSERT_EQ(delta, delta_copied);
+  RAJA::TypedDeltaListSegment<TypeParam> delta_moved(std::move(delta_copied));
+  ASSERT_EQ(delta, delta_moved);
+
+  RAJA::TypedRunListSegment<TypeParam> run(&idx[0], idx.size());
+  RAJA::TypedRunListSegment<TypeParam> run_copied(run);
+  ASSERT_EQ(run, run_copied);
+  RAJA::TypedRunListSegment<TypeParam> run_moved(std::move(run_copied));
+  ASSERT_EQ(run, run_moved);
+
+  camp::resources::Resource host_res{camp::resources::Host()};
+  RAJA::TypedRunListSegment<TypeParam> run_res(&idx[0], idx.size(), host_res);
+  ASSERT_EQ(run, run_res);
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Swaps)
+{
+  std::vector<TypeParam> idx1{1, 2, 3, 7};
+  std::vector<TypeParam> idx2{4, 5, 9};
+
+  RAJA::TypedRunListSegment<TypeParam> run1(&idx1[0], idx1.size());
+  RAJA::TypedRunListSegment<TypeParam> run2(&idx2[0], idx2.size());
+  std::swap(run1, run2);
+  ASSERT_EQ(3, run1.size());
+  ASSERT_EQ(TypeParam(9), *(run1.end() - 1));
+  ASSERT_EQ(TypeParam(7), *(run2.end() - 1));
+
+  RAJA::TypedDeltaListSegment<TypeParam> delta1(&idx1[0], idx1.size());
+  RAJA::TypedDeltaListSegment<TypeParam> delta2(&idx2[0], idx2.size());
+  delta1.swap(delta2);
+  ASSERT_EQ(3, delta1.size());
+  ASSERT_EQ(TypeParam(4), *delta1.begin());
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Iterators)
+{
+  std::vector<TypeParam> idx = makeRunIndices<TypeParam>(1000);
+  idx[500] = 40;  // out of order
+
+  RAJA::TypedDeltaListSegment<TypeParam> delta(&idx[0], idx.size());
+  RAJA::TypedRunListSegment<TypeParam> run(&idx[0], idx.size());
+  ASSERT_EQ(RAJA::Index_type(idx.size()), delta.size());
+  ASSERT_EQ(RAJA::Index_type(idx.size()), run.size());
+  ASSERT_EQ(RAJA::Index_type(idx.size()), run.end() - run.begin());
+  ASSERT_LT(run.getNumRuns(), RAJA::Index_type(idx.size()) / 5);
+
+  for (size_t i = 0; i < idx.size(); ++i) {
+    ASSERT_EQ(idx[i], delta.begin()[i]);
+    ASSERT_EQ(idx[i], *(run.begin() + i));
+  }
+
+  size_t i = 0;
+  for (TypeParam val : run) {
+    ASSERT_EQ(idx[i++], val);
+  }
+}
+
+TEST(CompressedListSegmentUnitTest, DeltaEncodable)
+{
+  std::vector<int> idx{0, 65535, 100000, 100001};
+  ASSERT_TRUE(RAJA::TypedDeltaListSegment<int>::encodable(&idx[0], 2));
+  ASSERT_FALSE(RAJA::TypedDeltaListSegment<int>::encodable(&idx[0], 3));
+  ASSERT_ANY_THROW(RAJA::TypedDeltaListSegment<int>(&idx[0], 4));
+
+  // blocks of 64 are encoded separately
+  std::vector<int> far(128, 0);
+  for (int i = 64; i < 128; ++i) {
+    far[i] = 1000000 + i;
+  }
+  RAJA::TypedDeltaListSegment<int> delta(&far[0], far.size());
+  ASSERT_EQ(1000000 + 127, *(delta.end() - 1));
+}
+
+TEST(CompressedListSegmentUnitTest, Forall)
+{
+  using IndexSetType = RAJA::TypedIndexSet<RAJA::RunListSegment,
+                                           RAJA::DeltaListSegment,
+                                           RAJA::ListSegment>;
+
+  std::vector<RAJA::Index_type> idx = makeRunIndices<RAJA::Index_type>(600);
+
+  IndexSetType iset;
+  iset.push_back(RAJA::RunListSegment(&idx[0], 200));
+  iset.push_back(RAJA::DeltaListSegment(&idx[200], 200));
+  iset.push_back(RAJA::ListSegment(&idx[400], 200));
+  ASSERT_EQ(size_t(600), iset.getLength());
+
+  std::vector<RAJA::Index_type> visited(idx.back() + 1, -1);
+  RAJA::Index_type* visited_ptr = &visited[0];
+  RAJA::forall_Icount<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [=](RAJA::Index_type icount, RAJA::Index_type i) {
+        visited_ptr[i] = icount;
+      });
+  for (size_t i = 0; i < idx.size(); ++i) {
+    ASSERT_EQ(RAJA::Index_type(i), visited[idx[i]]);
+  }
+
+  RAJA::Index_type sum = 0;
+  RAJA::Index_type* sum_ptr = &sum;
+  RAJA::forall<RAJA::seq_exec>(iset.getSegment<const RAJA::RunListSegment>(0),
+                               [=](RAJA::Index_type i) { *sum_ptr += i; });
+  RAJA::Index_type ref_sum = 0;
+  for (int i = 0; i < 200; ++i) {
+    ref_sum += idx[i];
+  }
+  ASSERT_EQ(ref_sum, sum);
+}
+
+template <typename ExecPolicy>
+void testRunListForall()
+{
+  std::vector<RAJA::Index_type> idx = makeRunIndices<RAJA::Index_type>(5000);
+  RAJA::RunListSegment seg(&idx[0], idx.size());
+
+  std::vector<int> count(idx.back() + 1, 0);
+  int* count_ptr = &count[0];
+  RAJA::forall<ExecPolicy>(seg, [=](RAJA::Index_type i) { count_ptr[i]++; });
+  for (RAJA::Index_type i : idx) {
+    count[i]--;
+  }
+  for (int c : count) {
+    ASSERT_EQ(0, c);
+  }
+
+  std::vector<RAJA::Index_type> icount(idx.back() + 1, -1);
+  RAJA::Index_type* icount_ptr = &icount[0];
+  RAJA::forall_Icount<ExecPolicy>(
+      seg, 10, [=](RAJA::Index_type ic, RAJA::Index_type i) {
+        icount_ptr[i] = ic;
+      });
+  for (size_t ic = 0; ic < idx.size(); ++ic) {
+    ASSERT_EQ(RAJA::Index_type(ic) + 10, icount[idx[ic]]);
+  }
+}
+
+TEST(CompressedListSegmentUnitTest, RunListForall)
+{
+  testRunListForall<RAJA::seq_exec>();
+  testRunListForall<RAJA::loop_exec>();
+  testRunListForall<RAJA::simd_exec>();
+#if defined(RAJA_ENABLE_OPENMP)
+  testRunListForall<RAJA::omp_parallel_for_exec>();
+#endif
+}
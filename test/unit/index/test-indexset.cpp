@@ -9,6 +9,9 @@
 /// Source file containing unit tests for IndexSet class.
 ///
 
+#include <algorithm>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "RAJA/RAJA.hpp"
@@ -217,3 +220,226 @@ TEST(IndexSetUnitTest, ConditionalLessThan100Indices)
     EXPECT_EQ(lt100_indices[i], ref_lt100_indices[i]);
   }
 }
+
+TEST(IndexSetUnitTest, ManySegments)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using StrideSegType = RAJA::TypedRangeStrideSegment<int>;
+  using RSIndexSetType = RAJA::TypedIndexSet<RangeSegType, StrideSegType>;
+  RSIndexSetType iset;
+
+  const int num_seg = 10000;
+  iset.push_back(RangeSegType(0, 2));
+  RSIndexSetType slice = iset.createSlice(0, 1);
+  const RangeSegType* first = &iset.getSegment<const RangeSegType>(0);
+
+  for (int i = 1; i < num_seg; ++i) {
+    if (i % 2) {
+      iset.push_back(StrideSegType(2 * i, 2 * i + 2, 1));
+    } else {
+      iset.push_back(RangeSegType(2 * i, 2 * i + 2));
+    }
+  }
+  ASSERT_EQ(num_seg, iset.size());
+  ASSERT_EQ(size_t(2 * num_seg), iset.getLength());
+
+  // segments do not move as more are added
+  ASSERT_EQ(first, &iset.getSegment<const RangeSegType>(0));
+  ASSERT_EQ(first, &slice.getSegment<const RangeSegType>(0));
+
+  RAJA::RAJAVec<int> indices;
+  getIndices(indices, iset);
+  ASSERT_EQ(size_t(2 * num_seg), indices.size());
+  for (int i = 0; i < 2 * num_seg; ++i) {
+    ASSERT_EQ(i, indices[i]);
+  }
+  ASSERT_EQ(2 * (num_seg - 1), iset.getStartingIcount(num_seg - 1));
+}
+
+TEST(IndexSetUnitTest, DependencyGraph)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using RIndexSetType = RAJA::TypedIndexSet<RangeSegType>;
+  RIndexSetType iset;
+
+  for (int i = 0; i < 4; ++i) {
+    iset.push_back(RangeSegType(i * 10, (i + 1) * 10));
+  }
+  ASSERT_FALSE(iset.dependencyGraphSet());
+  ASSERT_EQ(iset.getDependencyGraph(), nullptr);
+
+  // 0 -> {1, 2} -> 3
+  iset.initDependencyGraph();
+  RAJA::DepGraph* graph = iset.getDependencyGraph();
+  ASSERT_EQ(graph->size(), 4);
+  graph->addDependentTask(0, 1);
+  graph->addDependentTask(1, 3);
+  graph->addDependentTask(0, 2);
+  graph->addDependentTask(2, 3);
+  ASSERT_FALSE(iset.dependencyGraphSet());
+
+  iset.finalizeDependencyGraph();
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  ASSERT_EQ(iset.getDepGraphNode(0)->semaphoreReloadValue(), 0);
+  ASSERT_EQ(iset.getDepGraphNode(1)->semaphoreReloadValue(), 1);
+  ASSERT_EQ(iset.getDepGraphNode(2)->semaphoreReloadValue(), 1);
+  ASSERT_EQ(iset.getDepGraphNode(3)->semaphoreReloadValue(), 2);
+
+  ASSERT_EQ(iset.getDepGraphNode(0)->numDepTasks(), 2);
+  ASSERT_EQ(iset.getDepGraphNode(0)->depTaskNum(0), 1);
+  ASSERT_EQ(iset.getDepGraphNode(0)->depTaskNum(1), 2);
+  ASSERT_EQ(iset.getDepGraphNode(3)->numDepTasks(), 0);
+
+  ASSERT_FALSE(iset.getDepGraphNode(3)->satisfyOne());
+  ASSERT_TRUE(iset.getDepGraphNode(3)->satisfyOne());
+
+  // copies share the graph
+  RIndexSetType iset2(iset);
+  ASSERT_EQ(iset2.getDependencyGraph(), iset.getDependencyGraph());
+
+  // dependencies must point forward
+  ASSERT_ANY_THROW(graph->addDependentTask(3, 0));
+  ASSERT_ANY_THROW(graph->addDependentTask(2, 4));
+  ASSERT_TRUE(iset.dependencyGraphSet());
+}
+
+//
+// Checks that iset is a valid lock-free coloring of the domains in
+// domainToRange: every domain is in one segment, and no two domains in a
+// segment share a range. With a permutation, segments index the permuted
+// domains. Returns the size of the largest segment.
+//
+static size_t checkColorIndexset(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::RangeStrideSegment>& iset,
+    std::vector<RAJA::Index_type> const& domainToRange,
+    int numRangePerDomain,
+    int numEntityRange,
+    RAJA::Index_type const* elemPermutation)
+{
+  const int numEntity =
+      static_cast<int>(domainToRange.size()) / numRangePerDomain;
+  std::vector<int> domainColor(numEntity, -1);
+  std::vector<int> rangeColor(numEntityRange, -1);
+  size_t maxSize = 0;
+
+  for (int c = 0; c < static_cast<int>(iset.getNumSegments()); ++c) {
+    RAJA::RAJAVec<RAJA::Index_type> indices;
+    getIndices(indices, iset.createSlice(c, c + 1));
+    maxSize = std::max(maxSize, indices.size());
+    for (size_t k = 0; k < indices.size(); ++k) {
+      const RAJA::Index_type i =
+          elemPermutation ? elemPermutation[indices[k]] : indices[k];
+      EXPECT_EQ(domainColor[i], -1);
+      domainColor[i] = c;
+      for (int r = 0; r < numRangePerDomain; ++r) {
+        const RAJA::Index_type range = domainToRange[i * numRangePerDomain + r];
+        EXPECT_NE(rangeColor[range], c);
+        rangeColor[range] = c;
+      }
+    }
+  }
+  for (int i = 0; i < numEntity; ++i) {
+    EXPECT_NE(domainColor[i], -1);
+  }
+  return maxSize;
+}
+
+TEST(IndexSetUnitTest, ParallelColor)
+{
+  using ColorIndexSetType = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                                RAJA::ListSegment,
+                                                RAJA::RangeStrideSegment>;
+
+  // zones of a 2d mesh touch the nodes at their corners
+  const int nx = 64;
+  const int ny = 48;
+  const int numZones = nx * ny;
+  const int numNodes = (nx + 1) * (ny + 1);
+  std::vector<RAJA::Index_type> zoneToNode;
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      const RAJA::Index_type n = j * (nx + 1) + i;
+      zoneToNode.push_back(n);
+      zoneToNode.push_back(n + 1);
+      zoneToNode.push_back(n + nx + 1);
+      zoneToNode.push_back(n + nx + 2);
+    }
+  }
+
+  ColorIndexSetType iset;
+  RAJA::buildParallelColorIndexset(
+      iset, zoneToNode.data(), numZones, 4, numNodes);
+  const size_t maxSize =
+      checkColorIndexset(iset, zoneToNode, 4, numNodes, nullptr);
+  ASSERT_EQ(size_t(numZones), iset.getLength());
+  ASSERT_LE(iset.getNumSegments(), size_t(8));
+  // no color is much larger than the average
+  ASSERT_LE(maxSize, 2 * numZones / iset.getNumSegments());
+
+  std::vector<RAJA::Index_type> perm(numZones);
+  std::vector<RAJA::Index_type> iperm(numZones);
+  ColorIndexSetType piset;
+  RAJA::buildParallelColorIndexset(piset,
+                                   zoneToNode.data(),
+                                   numZones,
+                                   4,
+                                   numNodes,
+                                   perm.data(),
+                                   iperm.data());
+  checkColorIndexset(piset, zoneToNode, 4, numNodes, perm.data());
+  for (int i = 0; i < numZones; ++i) {
+    ASSERT_EQ(i, iperm[perm[i]]);
+  }
+
+  // each domain touches 3 of 500 ranges at random
+  const int numDomains = 2000;
+  const int numRanges = 500;
+  std::vector<RAJA::Index_type> domainToRange;
+  unsigned int seed = 1;
+  for (int i = 0; i < numDomains; ++i) {
+    for (int r = 0; r < 3; ++r) {
+      seed = seed * 1103515245u + 12345u;
+      const int bucket = numRanges / 3;
+      domainToRange.push_back((seed >> 8) % bucket + r * bucket);
+    }
+  }
+  ColorIndexSetType riset;
+  RAJA::buildParallelColorIndexset(
+      riset, domainToRange.data(), numDomains, 3, numRanges);
+  checkColorIndexset(riset, domainToRange, 3, numRanges, nullptr);
+  ASSERT_EQ(size_t(numDomains), riset.getLength());
+
+  ColorIndexSetType bad;
+  ASSERT_ANY_THROW(RAJA::buildParallelColorIndexset(
+      bad, domainToRange.data(), numDomains, 3, numRanges / 2));
+}
+
+TEST(IndexSetUnitTest, AlignedParallel)
+{
+  using AlignedIndexSetType =
+      RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>;
+
+  // runs of consecutive indices of many lengths, with gaps between them
+  std::vector<RAJA::Index_type> indices;
+  RAJA::Index_type next = 3;
+  for (int run = 0; run < 400; ++run) {
+    const int runLength = (run % 7 == 0) ? 5 * RANGE_ALIGN + run : run % 5 + 1;
+    for (int i = 0; i < runLength; ++i) {
+      indices.push_back(next++);
+    }
+    next += run % 3 + 1;
+  }
+  const RAJA::Index_type length = static_cast<RAJA::Index_type>(indices.size());
+
+  for (RAJA::Index_type len : {RAJA::Index_type(0), length / 3, length}) {
+    AlignedIndexSetType serial;
+    AlignedIndexSetType parallel;
+    RAJA::buildTypedIndexSetAligned(serial, indices.data(), len);
+    RAJA::buildTypedIndexSetAlignedParallel(parallel, indices.data(), len);
+    ASSERT_EQ(serial.getNumSegments(), parallel.getNumSegments());
+    ASSERT_TRUE(serial == parallel);
+    ASSERT_EQ(size_t(len), parallel.getLength());
+  }
+}
@@ -0,0 +1,130 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+TEST(AoSoAUnitTest, Blocks)
+{
+  using aosoa_t = RAJA::AoSoAView<4, double, int, char, double>;
+
+  // 32 bytes of doubles, 16 of ints, 4 of chars padded to 8, 32 of doubles,
+  // with the block padded to a multiple of DATA_ALIGN
+  const std::size_t block_bytes =
+      (88 + RAJA::DATA_ALIGN - 1) / RAJA::DATA_ALIGN * RAJA::DATA_ALIGN;
+  ASSERT_EQ(block_bytes, aosoa_t::block_bytes);
+  ASSERT_EQ(0u, aosoa_t::block_bytes % RAJA::DATA_ALIGN);
+  ASSERT_EQ(3u * block_bytes, aosoa_t::bytes(9));
+
+  std::vector<double> buf(3 * block_bytes / sizeof(double));
+  aosoa_t zones(buf.data(), 9);
+
+  ASSERT_EQ(9, zones.size());
+  ASSERT_EQ(3, zones.num_blocks());
+
+  char* base = static_cast<char*>(zones.data());
+  ASSERT_EQ(base, reinterpret_cast<char*>(zones.block<0>(0)));
+  ASSERT_EQ(base + 32, reinterpret_cast<char*>(zones.block<1>(0)));
+  ASSERT_EQ(base + 48, reinterpret_cast<char*>(zones.block<2>(0)));
+  ASSERT_EQ(base + 56, reinterpret_cast<char*>(zones.block<3>(0)));
+  ASSERT_EQ(base + 2 * block_bytes + 56,
+            reinterpret_cast<char*>(zones.block<3>(2)));
+
+  // element 6 is lane 2 of block 1
+  ASSERT_EQ(zones.block<1>(1) + 2, &zones.get<1>(6));
+}
+
+TEST(AoSoAUnitTest, Fields)
+{
+  RAJA::AoSoA<8, double, float, int, double> zones(21);
+
+  ASSERT_EQ(0u,
+            reinterpret_cast<std::uintptr_t>(zones.data()) %
+                RAJA::DATA_ALIGN);
+
+  for (RAJA::Index_type i = 0; i < 21; ++i) {
+    zones.get<0>(i) = i;
+    zones.get<1>(i) = 2 * i;
+    zones.get<2>(i) = 3 * i;
+    zones.get<3>(i) = 4 * i;
+  }
+
+  auto f0 = zones.field<0>();
+  auto f1 = zones.field<1>();
+  auto f2 = zones.field<2>();
+  auto f3 = zones.field<3>();
+
+  for (RAJA::Index_type i = 0; i < 21; ++i) {
+    const RAJA::Index_type b = i / 8, l = i % 8;
+    ASSERT_EQ(i, f0(b, l));
+    ASSERT_EQ(2 * i, f1(b, l));
+    ASSERT_EQ(3 * i, f2(b, l));
+    ASSERT_EQ(4 * i, f3(b, l));
+
+    RAJA::Index_type b2, l2;
+    f2.layout.toIndices(f2.layout(b, l), b2, l2);
+    ASSERT_EQ(b, b2);
+    ASSERT_EQ(l, l2);
+  }
+}
+
+TEST(AoSoAUnitTest, Move)
+{
+  RAJA::AoSoA<4, double, int> a(10);
+  a.get<1>(7) = 42;
+  void* data = a.data();
+
+  RAJA::AoSoA<4, double, int> b(std::move(a));
+  ASSERT_EQ(nullptr, a.data());
+  ASSERT_EQ(data, b.data());
+  ASSERT_EQ(10, b.size());
+  ASSERT_EQ(42, b.view().get<1>(7));
+
+  a = std::move(b);
+  ASSERT_EQ(data, a.data());
+  ASSERT_EQ(nullptr, b.data());
+}
+
+TEST(AoSoAUnitTest, KernelSimdLanes)
+{
+  const RAJA::Index_type n = 37;
+  RAJA::AoSoA<8, double, double, double> zones(n);
+
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    zones.get<0>(i) = 0.0;
+    zones.get<1>(i) = i;
+    zones.get<2>(i) = 2.0;
+  }
+
+  auto e = zones.field<0>();
+  auto p = zones.field<1>();
+  auto dv = zones.field<2>();
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::loop_exec,
+        RAJA::statement::For<1, RAJA::simd_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+  // whole blocks, the padding lanes of the last block are allocated
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, zones.num_blocks()),
+                       RAJA::RangeSegment(0, 8)),
+      [=](RAJA::Index_type b, RAJA::Index_type l) {
+        e(b, l) += p(b, l) * dv(b, l);
+      });
+
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(2.0 * i, zones.get<0>(i));
+  }
+}
@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+TEST(MortonLayoutUnitTest, 2D_ZOrder)
+{
+  const RAJA::MortonLayout<2> layout(4, 4);
+
+  ASSERT_EQ(16, layout.size());
+
+  // the last index takes the low bit of each pair
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(0, 1));
+  ASSERT_EQ(2, layout(1, 0));
+  ASSERT_EQ(3, layout(1, 1));
+  ASSERT_EQ(4, layout(0, 2));
+  ASSERT_EQ(8, layout(2, 0));
+  ASSERT_EQ(15, layout(3, 3));
+}
+
+TEST(MortonLayoutUnitTest, 3D_ZOrder)
+{
+  const RAJA::MortonLayout<3> layout(8, 8, 8);
+
+  ASSERT_EQ(512, layout.size());
+
+  ASSERT_EQ(1, layout(0, 0, 1));
+  ASSERT_EQ(2, layout(0, 1, 0));
+  ASSERT_EQ(4, layout(1, 0, 0));
+  ASSERT_EQ(7 * 64 + 7 * 8 + 7, layout(7, 7, 7));
+
+  // bits 8, 4 and 0 from i, j and k
+  ASSERT_EQ(256 + 16 + 1, layout(4, 2, 1));
+}
+
+TEST(MortonLayoutUnitTest, 3D_Bricks)
+{
+  /*
+   * Sizes that are not powers of two are split into bricks, check that the
+   * mapping is one-to-one and that toIndices inverts it
+   */
+  const RAJA::Index_type shapes[][3] = {{1, 1, 1},
+                                        {96, 96, 96},
+                                        {5, 17, 33},
+                                        {40, 24, 64},
+                                        {33, 65, 17}};
+
+  for (auto const& n : shapes) {
+    const RAJA::MortonLayout<3> layout(n[0], n[1], n[2]);
+    std::vector<int> hits(layout.size(), 0);
+
+    for (RAJA::Index_type i = 0; i < n[0]; ++i) {
+      for (RAJA::Index_type j = 0; j < n[1]; ++j) {
+        for (RAJA::Index_type k = 0; k < n[2]; ++k) {
+          const RAJA::Index_type lin = layout(i, j, k);
+          ASSERT_LE(0, lin);
+          ASSERT_LT(lin, layout.size());
+          ASSERT_EQ(0, hits[lin]++);
+
+          RAJA::Index_type i2, j2, k2;
+          layout.toIndices(lin, i2, j2, k2);
+          ASSERT_EQ(i, i2);
+          ASSERT_EQ(j, j2);
+          ASSERT_EQ(k, k2);
+        }
+      }
+    }
+  }
+}
+
+TEST(MortonLayoutUnitTest, View)
+{
+  using layout_t = RAJA::MortonLayout<2>;
+  const layout_t layout(12, 20);
+  std::vector<int> data(layout.size(), -1);
+
+  RAJA::View<int, layout_t> view(data.data(), 12, 20);
+
+  for (int i = 0; i < 12; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      view(i, j) = i * 20 + j;
+    }
+  }
+
+  for (int i = 0; i < 12; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      ASSERT_EQ(i * 20 + j, data[layout(i, j)]);
+    }
+  }
+}
@@ -176,3 +176,85 @@ TEST(LayoutUnitTest, 2D_IJ_ProjJ)
   }
 }
 
+
+TEST(LayoutUnitTest, 3D_LayoutDivisors)
+{
+  /*
+   * LayoutDivisors divides by precomputed reciprocals of the strides and
+   * sizes, check it against toIndices for many shapes, including
+   * projected dimensions and strides too large for 32-bit divisors.
+   */
+  const RAJA::Index_type shapes[][3] = {{1, 1, 1},
+                                        {3, 5, 7},
+                                        {64, 1, 33},
+                                        {7, 0, 11},
+                                        {0, 0, 4},
+                                        {100003, 65537, 3},
+                                        {2147483647L, 6, 5}};
+
+  for (auto const& n : shapes) {
+    const RAJA::Layout<3> layout(n[0], n[1], n[2]);
+    const auto div = RAJA::make_layout_divisors(layout);
+    const RAJA::Index_type s0 = n[0] ? n[0] : 1;
+    const RAJA::Index_type s1 = n[1] ? n[1] : 1;
+    const RAJA::Index_type s2 = n[2] ? n[2] : 1;
+
+    for (RAJA::Index_type step = 0; step < 1000; ++step) {
+      // sample the whole linear space, and beyond to check wraparound
+      const RAJA::Index_type lin = step * (2 * s0 * s1 * s2 / 997 + 1);
+      RAJA::Index_type i, j, k;
+      div.toIndices(lin, i, j, k);
+
+      ASSERT_EQ(n[0] ? (lin / (s1 * s2)) % s0 : 0, i);
+      ASSERT_EQ(n[1] ? (lin / s2) % s1 : 0, j);
+      ASSERT_EQ(n[2] ? lin % s2 : 0, k);
+
+      RAJA::Index_type i2, j2, k2;
+      layout.toIndices(lin, i2, j2, k2);
+      ASSERT_EQ(i2, i);
+      ASSERT_EQ(j2, j);
+      ASSERT_EQ(k2, k);
+    }
+  }
+
+  // layouts do not carry the reciprocals
+  ASSERT_EQ(sizeof(RAJA::Layout<3>), 12 * sizeof(RAJA::Index_type));
+}
+
+TEST(LayoutUnitTest, 3D_PermutedToIndices)
+{
+  const auto layout = RAJA::make_permuted_layout(
+      {{5, 7, 3}}, RAJA::as_array<RAJA::PERM_KIJ>::get());
+  const auto div = RAJA::make_layout_divisors(layout);
+
+  for (RAJA::Index_type lin = 0; lin < layout.size(); ++lin) {
+    RAJA::Index_type i, j, k;
+    layout.toIndices(lin, i, j, k);
+    ASSERT_EQ(lin, layout(i, j, k));
+
+    RAJA::Index_type i2, j2, k2;
+    div.toIndices(lin, i2, j2, k2);
+    ASSERT_EQ(i, i2);
+    ASSERT_EQ(j, j2);
+    ASSERT_EQ(k, k2);
+  }
+}
+
+TEST(OffsetLayoutUnitTest, 2D_ToIndices)
+{
+  const auto layout = RAJA::make_offset_layout<2>({{-1, 10}}, {{3, 16}});
+  const auto div = RAJA::make_layout_divisors(layout);
+
+  for (RAJA::Index_type lin = 0; lin < 35; ++lin) {
+    RAJA::Index_type i, j;
+    layout.toIndices(lin, i, j);
+    ASSERT_EQ(lin / 7 - 1, i);
+    ASSERT_EQ(lin % 7 + 10, j);
+    ASSERT_EQ(lin, layout(i, j));
+
+    RAJA::Index_type i2, j2;
+    div.toIndices(lin, i2, j2);
+    ASSERT_EQ(i, i2);
+    ASSERT_EQ(j, j2);
+  }
+}
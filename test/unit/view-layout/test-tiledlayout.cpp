@@ -0,0 +1,138 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+RAJA_INDEX_VALUE(TI, "TI");
+RAJA_INDEX_VALUE(TJ, "TJ");
+
+TEST(TiledLayoutUnitTest, 2D_Tiles)
+{
+  /*
+   * 5x7 elements in 2x4 tiles, the grid of tiles is 3x2 and
+   * the last row and column of tiles are padded
+   */
+  const RAJA::TiledLayout<2, 2, 4> layout(5, 7);
+
+  ASSERT_EQ(8, layout.tile_volume);
+  ASSERT_EQ(48, layout.size());
+
+  // first tile holds rows 0-1, columns 0-3, row-major
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(3, layout(0, 3));
+  ASSERT_EQ(4, layout(1, 0));
+  ASSERT_EQ(7, layout(1, 3));
+
+  // second tile holds rows 0-1, columns 4-7
+  ASSERT_EQ(8, layout(0, 4));
+
+  // third tile starts at row 2
+  ASSERT_EQ(16, layout(2, 0));
+
+  // last element is in the sixth tile
+  ASSERT_EQ(40 + 0 * 4 + 2, layout(4, 6));
+
+  // the mapping is one-to-one, and toIndices inverts it
+  std::vector<int> hits(layout.size(), 0);
+  for (RAJA::Index_type i = 0; i < 5; ++i) {
+    for (RAJA::Index_type j = 0; j < 7; ++j) {
+      RAJA::Index_type lin = layout(i, j);
+      ASSERT_LT(lin, layout.size());
+      ++hits[lin];
+
+      RAJA::Index_type i2, j2;
+      layout.toIndices(lin, i2, j2);
+      ASSERT_EQ(i, i2);
+      ASSERT_EQ(j, j2);
+    }
+  }
+  for (int h : hits) {
+    ASSERT_LE(h, 1);
+  }
+}
+
+TEST(TiledLayoutUnitTest, 3D_ToIndices)
+{
+  const RAJA::TiledLayout<3, 4, 3, 8> layout(9, 10, 17);
+
+  ASSERT_EQ(3 * 4 * 3 * 4 * 3 * 8, layout.size());
+
+  for (RAJA::Index_type i = 0; i < 9; ++i) {
+    for (RAJA::Index_type j = 0; j < 10; ++j) {
+      for (RAJA::Index_type k = 0; k < 17; ++k) {
+        RAJA::Index_type i2, j2, k2;
+        layout.toIndices(layout(i, j, k), i2, j2, k2);
+        ASSERT_EQ(i, i2);
+        ASSERT_EQ(j, j2);
+        ASSERT_EQ(k, k2);
+      }
+    }
+  }
+}
+
+TEST(TiledLayoutUnitTest, Views)
+{
+  using layout_t = RAJA::TiledLayout<2, 4, 4>;
+  const layout_t layout(6, 9);
+  std::vector<int> data(layout.size(), -1);
+
+  RAJA::View<int, layout_t> view(data.data(), 6, 9);
+  RAJA::TypedView<int, layout_t, TI, TJ> tview(data.data(), 6, 9);
+
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 9; ++j) {
+      view(i, j) = i * 9 + j;
+    }
+  }
+
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 9; ++j) {
+      ASSERT_EQ(i * 9 + j, tview(TI{i}, TJ{j}));
+      ASSERT_EQ(i * 9 + j, data[layout(i, j)]);
+    }
+  }
+}
+
+TEST(TiledLayoutUnitTest, KernelTileLayout)
+{
+  using layout_t = RAJA::TiledLayout<2, 4, 8>;
+  const layout_t layout(13, 21);
+  std::vector<RAJA::Index_type> order;
+
+  // interior of the layout, the first and last tiles of each dimension are
+  // partial
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Tile<0, RAJA::tile_layout<layout_t, 0>, RAJA::loop_exec,
+        RAJA::statement::Tile<1, RAJA::tile_layout<layout_t, 1>, RAJA::loop_exec,
+          RAJA::statement::For<0, RAJA::loop_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(1, 12), RAJA::RangeSegment(1, 20)),
+      [&](RAJA::Index_type i, RAJA::Index_type j) {
+        order.push_back(layout(i, j));
+      });
+
+  ASSERT_EQ(11u * 19u, order.size());
+
+  // each tile of the loop is one tile of the layout, visited in storage
+  // order
+  for (size_t n = 1; n < order.size(); ++n) {
+    ASSERT_LE(order[n - 1] / layout_t::tile_volume,
+              order[n] / layout_t::tile_volume);
+    ASSERT_LT(order[n - 1], order[n]);
+  }
+}